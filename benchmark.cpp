@@ -0,0 +1,371 @@
+/*!
+ * @file benchmark.cpp
+ * @brief Microbenchmarks comparing List against std::vector
+ *
+ * Self-contained timer harness; build with optimizations, e.g.
+ *
+ *     g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+ *     ./benchmark --json > bench_output.json
+ *
+ * Options:
+ *   --json            Print results as a JSON array instead of a table
+ *   --max-size N      Largest list size to run (default 1000000; use 10000000 for the full sweep)
+ *   --min-time S      Minimum seconds spent per measurement (default 0.05)
+ *   --filter TEXT     Only run benchmarks whose name contains TEXT
+ */
+
+#include "list.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/*!
+ * @brief 64-byte plain-old-data record used as the "large trivially copyable" element type.
+ */
+struct Pod64 {
+    int64_t key;
+    char payload[56];
+
+    bool operator==(const Pod64& other) const {
+        return key == other.key;
+    }
+};
+
+static_assert(sizeof(Pod64) == 64, "Pod64 must be exactly one cache line");
+
+/*!
+ * @brief Builds the i-th benchmark value of each element type.
+ */
+template <typename T>
+T make_value(size_t i);
+
+template <>
+int make_value<int>(size_t i) {
+    return static_cast<int>(i);
+}
+
+template <>
+std::string make_value<std::string>(size_t i) {
+    // 32 characters: longer than the small-string buffer, so every string owns a heap block
+    std::string value = "benchmark-value-" + std::to_string(i);
+    value.resize(32, '.');
+    return value;
+}
+
+template <>
+Pod64 make_value<Pod64>(size_t i) {
+    Pod64 value;
+    value.key = static_cast<int64_t>(i);
+    std::memset(value.payload, static_cast<int>(i & 0xff), sizeof(value.payload));
+    return value;
+}
+
+/*!
+ * @brief Reduces an element to a number, so iteration loops cannot be optimized away.
+ */
+inline uint64_t digest(int value) {
+    return static_cast<uint64_t>(value);
+}
+
+inline uint64_t digest(const std::string& value) {
+    return value.size() + static_cast<unsigned char>(value.back());
+}
+
+inline uint64_t digest(const Pod64& value) {
+    return static_cast<uint64_t>(value.key) + static_cast<unsigned char>(value.payload[0]);
+}
+
+/*!
+ * @brief Uniform operations over List and std::vector.
+ */
+template <typename T>
+struct ListOps {
+    using Container = List<T>;
+    static constexpr const char* name = "List";
+
+    static void push(Container& c, const T& v) { c.add(v); }
+    static void insert(Container& c, size_t index, const T& v) { c.insert(index, v); }
+    static void erase(Container& c, size_t index) { c.remove_at(index); }
+    static long find(const Container& c, const T& v) { return c.index_of(v); }
+    static size_t size(const Container& c) { return c.length(); }
+};
+
+template <typename T>
+struct VectorOps {
+    using Container = std::vector<T>;
+    static constexpr const char* name = "std::vector";
+
+    static void push(Container& c, const T& v) { c.push_back(v); }
+    static void insert(Container& c, size_t index, const T& v) { c.insert(c.begin() + static_cast<long>(index), v); }
+    static void erase(Container& c, size_t index) { c.erase(c.begin() + static_cast<long>(index)); }
+    static long find(const Container& c, const T& v) {
+        auto it = std::find(c.begin(), c.end(), v);
+        return it == c.end() ? -1 : static_cast<long>(it - c.begin());
+    }
+    static size_t size(const Container& c) { return c.size(); }
+};
+
+/*!
+ * @brief Accumulated timing of one benchmark at one size.
+ */
+struct Measurement {
+    double seconds = 0.0;
+    double ops = 0.0;
+};
+
+/*!
+ * @brief One result row.
+ */
+struct Result {
+    std::string benchmark;
+    std::string container;
+    std::string type;
+    size_t size;
+    double ns_per_op;
+    double ops;
+};
+
+/*!
+ * @brief Harness settings from the command line.
+ */
+struct Options {
+    bool json = false;
+    size_t max_size = 1000000;
+    double min_time = 0.05;
+    std::string filter;
+};
+
+static volatile uint64_t sink; ///< Keeps benchmark results observable
+
+using Clock = std::chrono::steady_clock;
+
+inline double elapsed_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/*!
+ * @brief Fills a fresh container with n values.
+ */
+template <typename Ops, typename T>
+typename Ops::Container filled(size_t n) {
+    typename Ops::Container c;
+    for (size_t i = 0; i < n; ++i) {
+        Ops::push(c, make_value<T>(i));
+    }
+    return c;
+}
+
+/*!
+ * @brief The measured operations. Each run does its own untimed setup and returns the
+ *        time and the number of operations of its timed part.
+ */
+template <typename Ops, typename T>
+struct Benchmarks {
+    using Container = typename Ops::Container;
+
+    static Measurement add(size_t n) {
+        std::vector<T> values;
+        values.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            values.push_back(make_value<T>(i));
+        }
+        auto start = Clock::now();
+        Container c;
+        for (size_t i = 0; i < n; ++i) {
+            Ops::push(c, values[i]);
+        }
+        double seconds = elapsed_since(start);
+        sink = sink + Ops::size(c);
+        return {seconds, static_cast<double>(n)};
+    }
+
+    /*!
+     * @brief Inserts (or removes) a bounded number of elements so huge sizes stay tractable.
+     */
+    static size_t shift_ops(size_t n) {
+        return std::min<size_t>(n, 256);
+    }
+
+    static Measurement insert_front(size_t n) {
+        Container c = filled<Ops, T>(n);
+        size_t ops = shift_ops(n);
+        T value = make_value<T>(n);
+        auto start = Clock::now();
+        for (size_t i = 0; i < ops; ++i) {
+            Ops::insert(c, 0, value);
+        }
+        return {elapsed_since(start), static_cast<double>(ops)};
+    }
+
+    static Measurement insert_middle(size_t n) {
+        Container c = filled<Ops, T>(n);
+        size_t ops = shift_ops(n);
+        T value = make_value<T>(n);
+        auto start = Clock::now();
+        for (size_t i = 0; i < ops; ++i) {
+            Ops::insert(c, Ops::size(c) / 2, value);
+        }
+        return {elapsed_since(start), static_cast<double>(ops)};
+    }
+
+    static Measurement remove_front(size_t n) {
+        Container c = filled<Ops, T>(n);
+        size_t ops = shift_ops(n);
+        auto start = Clock::now();
+        for (size_t i = 0; i < ops; ++i) {
+            Ops::erase(c, 0);
+        }
+        return {elapsed_since(start), static_cast<double>(ops)};
+    }
+
+    static Measurement index_of_missing(size_t n) {
+        Container c = filled<Ops, T>(n);
+        T missing = make_value<T>(n + 1);
+        size_t repeats = std::max<size_t>(1, 1000000 / n);
+        auto start = Clock::now();
+        long found = 0;
+        for (size_t r = 0; r < repeats; ++r) {
+            found += Ops::find(c, missing);
+        }
+        double seconds = elapsed_since(start);
+        sink = sink + static_cast<uint64_t>(found);
+        return {seconds, static_cast<double>(repeats * n)};
+    }
+
+    static Measurement iterate(size_t n) {
+        Container c = filled<Ops, T>(n);
+        size_t repeats = std::max<size_t>(1, 1000000 / n);
+        auto start = Clock::now();
+        uint64_t total = 0;
+        for (size_t r = 0; r < repeats; ++r) {
+            for (const T& value : c) {
+                total += digest(value);
+            }
+        }
+        double seconds = elapsed_since(start);
+        sink = sink + total;
+        return {seconds, static_cast<double>(repeats * n)};
+    }
+
+    static Measurement move_assign(size_t n) {
+        Container a = filled<Ops, T>(n);
+        Container b;
+        const size_t ops = 10000;
+        auto start = Clock::now();
+        for (size_t i = 0; i < ops; ++i) {
+            b = std::move(a);
+            a = std::move(b);
+        }
+        double seconds = elapsed_since(start);
+        sink = sink + Ops::size(a);
+        return {seconds, static_cast<double>(2 * ops)};
+    }
+};
+
+/*!
+ * @brief Repeats a run until min_time has been spent in its timed part.
+ */
+template <typename Run>
+Measurement measure(Run run, size_t n, double min_time) {
+    Measurement total;
+    do {
+        Measurement m = run(n);
+        total.seconds += m.seconds;
+        total.ops += m.ops;
+    } while (total.seconds < min_time);
+    return total;
+}
+
+template <typename Ops, typename T>
+void run_container(const char* type_name, const std::vector<size_t>& sizes, const Options& options,
+                   std::vector<Result>& results) {
+    using B = Benchmarks<Ops, T>;
+    struct Entry {
+        const char* name;
+        Measurement (*run)(size_t);
+    };
+    const Entry entries[] = {
+        {"add", &B::add},
+        {"insert_front", &B::insert_front},
+        {"insert_middle", &B::insert_middle},
+        {"remove_front", &B::remove_front},
+        {"index_of_missing", &B::index_of_missing},
+        {"iterate", &B::iterate},
+        {"move_assign", &B::move_assign},
+    };
+
+    for (const Entry& entry : entries) {
+        if (!options.filter.empty() && std::string(entry.name).find(options.filter) == std::string::npos) {
+            continue;
+        }
+        for (size_t n : sizes) {
+            Measurement m = measure(entry.run, n, options.min_time);
+            results.push_back({entry.name, Ops::name, type_name, n, m.seconds * 1e9 / m.ops, m.ops});
+            if (!options.json) {
+                std::printf("%-18s %-12s %-12s %10zu %12.2f ns/op\n", entry.name, Ops::name, type_name, n,
+                            results.back().ns_per_op);
+                std::fflush(stdout);
+            }
+        }
+    }
+}
+
+template <typename T>
+void run_type(const char* type_name, const Options& options, std::vector<Result>& results) {
+    const size_t all_sizes[] = {16, 256, 4096, 65536, 1000000, 10000000};
+    std::vector<size_t> sizes;
+    for (size_t n : all_sizes) {
+        if (n <= options.max_size) {
+            sizes.push_back(n);
+        }
+    }
+    run_container<ListOps<T>, T>(type_name, sizes, options, results);
+    run_container<VectorOps<T>, T>(type_name, sizes, options, results);
+}
+
+void print_json(const std::vector<Result>& results) {
+    std::printf("[\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        std::printf("  {\"benchmark\": \"%s\", \"container\": \"%s\", \"type\": \"%s\", \"size\": %zu, "
+                    "\"ns_per_op\": %.3f, \"ops\": %.0f}%s\n",
+                    r.benchmark.c_str(), r.container.c_str(), r.type.c_str(), r.size, r.ns_per_op, r.ops,
+                    (i + 1 < results.size()) ? "," : "");
+    }
+    std::printf("]\n");
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--json") {
+            options.json = true;
+        } else if (arg == "--max-size" && i + 1 < argc) {
+            options.max_size = static_cast<size_t>(std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--min-time" && i + 1 < argc) {
+            options.min_time = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--filter" && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else {
+            std::fprintf(stderr, "usage: %s [--json] [--max-size N] [--min-time S] [--filter TEXT]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<Result> results;
+    run_type<int>("int", options, results);
+    run_type<std::string>("std::string", options, results);
+    run_type<Pod64>("pod64", options, results);
+
+    if (options.json) {
+        print_json(results);
+    }
+    return 0;
+}
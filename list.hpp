@@ -6,10 +6,535 @@
 #ifndef LIST_HPP
 #define LIST_HPP
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <cstddef>
 #include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+#include <type_traits>
+#include <utility>
+
+#include "list_batch.hpp"
+#include "list_simd.hpp"
+
+/*!
+ * @defgroup Configuration Build Configuration
+ *
+ * Two macros select how much checking List does. Define them (or neither) identically in
+ * every translation unit; the CMake targets dynamic_list_release and dynamic_list_debug do so:
+ *
+ * - LIST_NO_CHECKS, the release mode: the index checks of at, get_element, set_element,
+ *   insert, remove_at, swap_remove, remove_range and slice are compiled out, so an out-of-range
+ *   index is undefined behaviour instead of std::out_of_range.
+ * - LIST_DEBUG, the hardened mode: operator[] and at_unchecked are index-checked too,
+ *   List iterators throw std::logic_error when used after the list changed buffers (growth,
+ *   shrink_to_fit, move...) and std::out_of_range when dereferenced outside [begin, end), and
+ *   destroyed elements and freed buffers are overwritten with list_detail::poison_byte so stale
+ *   pointers read garbage instead of old values. Iterators are then classes rather than T*,
+ *   though they still convert to T* implicitly.
+ *
+ * The other containers of the library (RingList, StaticList, ChunkedList, SoAList,
+ * MappedList...) route their index and empty-container checks through the same
+ * list_detail::check_index / debug_check_index, so both macros apply to them as well.
+ *
+ * By default neither is defined: checked accessors throw and operator[] is unchecked.
+ * @{
+ */
+
+#if defined(LIST_NO_CHECKS) && defined(LIST_DEBUG)
+#error "LIST_NO_CHECKS and LIST_DEBUG are mutually exclusive"
+#endif
+
+/*!
+ * @brief Branch prediction hints for the hot paths (no-ops on compilers without __builtin_expect).
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define LIST_LIKELY(condition) __builtin_expect(!!(condition), 1)
+#define LIST_UNLIKELY(condition) __builtin_expect(!!(condition), 0)
+#else
+#define LIST_LIKELY(condition) (condition)
+#define LIST_UNLIKELY(condition) (condition)
+#endif
+
+/*! @} */ // End of Configuration group
+
+/*!
+ * @brief Trait telling List that a type may be relocated with a raw memcpy.
+ *
+ * Relocation means moving an object to new storage and ending the lifetime of the
+ * source in one step. Trivially copyable types qualify automatically; other types whose
+ * moved-from state needs no destructor call and that hold no pointers into themselves
+ * (e.g. std::unique_ptr, most handle types) can opt in by specializing this trait.
+ *
+ * @tparam T The element type.
+ */
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+namespace list_detail {
+
+/*!
+ * @brief Byte written over destroyed elements and freed buffers when LIST_DEBUG is set.
+ */
+constexpr unsigned char poison_byte = 0xDD;
+
+/*!
+ * @brief Throws std::out_of_range unless in_range; compiled out when LIST_NO_CHECKS is set.
+ */
+constexpr void check_index(bool in_range) {
+#ifdef LIST_NO_CHECKS
+    (void)in_range;
+#else
+    if (LIST_UNLIKELY(!in_range)) {
+        throw std::out_of_range("Index out of bounds");
+    }
+#endif
+}
+
+/*!
+ * @brief Like check_index, but only active when LIST_DEBUG is set (for unchecked accessors).
+ */
+constexpr void debug_check_index(bool in_range) {
+#ifdef LIST_DEBUG
+    check_index(in_range);
+#else
+    (void)in_range;
+#endif
+}
+
+/*!
+ * @brief Relocates n constructed objects from src into the raw storage at dst.
+ *
+ * Uses memcpy for trivially relocatable types. Otherwise each element is move-constructed
+ * (or copy-constructed if its move constructor may throw) through the allocator, and the
+ * sources are destroyed only after every destination has been built, so a throwing copy
+ * leaves src untouched.
+ *
+ * @param alloc The allocator used to construct and destroy elements.
+ * @param dst Uninitialized destination storage for n elements.
+ * @param src The n constructed source elements.
+ * @param n Number of elements to relocate.
+ */
+template <typename Allocator, typename T>
+void relocate(Allocator& alloc, T* dst, T* src, size_t n) {
+    using traits = std::allocator_traits<Allocator>;
+
+    if constexpr (is_trivially_relocatable<T>::value) {
+        if (n > 0) {
+            std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        }
+    } else {
+        size_t built = 0;
+        try {
+            for (; built < n; ++built) {
+                traits::construct(alloc, dst + built, std::move_if_noexcept(src[built]));
+            }
+        } catch (...) {
+            for (size_t i = 0; i < built; ++i) {
+                traits::destroy(alloc, dst + i);
+            }
+            throw;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            traits::destroy(alloc, src + i);
+        }
+    }
+}
+
+/*!
+ * @brief Branchless lower bound: index of the first element not ordered before value.
+ *
+ * The loop body compiles to a conditional move, so the search costs no mispredictions;
+ * the two candidate midpoints of the next step are prefetched while the current one loads.
+ */
+template <typename T, typename Compare>
+size_t branchless_lower_bound(const T* data, size_t n, const T& value, const Compare& comp) {
+    if (n == 0) {
+        return 0;
+    }
+    const T* base = data;
+    while (n > 1) {
+        size_t half = n / 2;
+#if defined(__GNUC__)
+        __builtin_prefetch(base + half / 2);
+        __builtin_prefetch(base + half + half / 2);
+#endif
+        base = comp(base[half], value) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<size_t>(base - data) + (comp(*base, value) ? 1 : 0);
+}
+
+/*!
+ * @brief Branchless upper bound: index of the first element ordered after value.
+ */
+template <typename T, typename Compare>
+size_t branchless_upper_bound(const T* data, size_t n, const T& value, const Compare& comp) {
+    if (n == 0) {
+        return 0;
+    }
+    const T* base = data;
+    while (n > 1) {
+        size_t half = n / 2;
+#if defined(__GNUC__)
+        __builtin_prefetch(base + half / 2);
+        __builtin_prefetch(base + half + half / 2);
+#endif
+        base = !comp(value, base[half]) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<size_t>(base - data) + (!comp(value, *base) ? 1 : 0);
+}
+
+/*!
+ * @brief Index of the highest set bit of a non-zero value.
+ */
+inline unsigned highest_bit(size_t value) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(sizeof(size_t) * 8 - 1 - __builtin_clzll(static_cast<unsigned long long>(value)));
+#else
+    unsigned bit = 0;
+    while (value >>= 1) {
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+} // namespace list_detail
+
+/*!
+ * @defgroup Growth Growth Policies
+ *
+ * A growth policy decides the new capacity when a list runs out of room. Each policy
+ * provides a static grow(capacity, required, element_size) returning a capacity of at
+ * least required.
+ * @{
+ */
+
+/*!
+ * @brief Doubles the capacity on every growth (the default).
+ */
+struct GrowthDouble {
+    static size_t grow(size_t capacity, size_t required, size_t /*element_size*/) {
+        size_t next = (capacity == 0) ? 1 : capacity * 2;
+        return (next < required || next < capacity) ? required : next;
+    }
+};
+
+/*!
+ * @brief Grows by 50%, trading more frequent reallocation for less slack memory.
+ */
+struct GrowthOneAndHalf {
+    static size_t grow(size_t capacity, size_t required, size_t /*element_size*/) {
+        size_t next = capacity + capacity / 2 + 1;
+        return (next < required || next < capacity) ? required : next;
+    }
+};
+
+/*!
+ * @brief Grows by a fixed number of elements, keeping slack bounded on long-lived lists.
+ *
+ * @tparam Increment Number of elements added per growth. Must be > 0.
+ */
+template <size_t Increment>
+struct GrowthFixed {
+    static_assert(Increment > 0, "GrowthFixed needs a positive increment");
+
+    static size_t grow(size_t capacity, size_t required, size_t /*element_size*/) {
+        size_t next = capacity + Increment;
+        return (next < required || next < capacity) ? required : next;
+    }
+};
+
+/*!
+ * @brief Applies another policy, then rounds the buffer size up to a whole number of pages.
+ *
+ * The rounding uses capacity the allocator would hand out anyway for page-sized requests,
+ * so large lists get the extra elements for free.
+ *
+ * @tparam Base The policy that picks the unrounded capacity.
+ * @tparam PageSize The page size in bytes (a power of two).
+ */
+template <typename Base = GrowthDouble, size_t PageSize = 4096>
+struct GrowthPageRounded {
+    static_assert(PageSize > 0 && (PageSize & (PageSize - 1)) == 0, "PageSize must be a power of two");
+
+    static size_t grow(size_t capacity, size_t required, size_t element_size) {
+        size_t next = Base::grow(capacity, required, element_size);
+        if (next > (static_cast<size_t>(-1) - PageSize) / element_size) {
+            return next;
+        }
+        size_t bytes = (next * element_size + PageSize - 1) & ~(PageSize - 1);
+        return bytes / element_size;
+    }
+};
+
+/*! @} */ // End of Growth group
+
+/*!
+ * @brief Statistics policy that records nothing (the default).
+ *
+ * A statistics policy receives a callback for every allocation, reallocation, element shift
+ * and search a list performs, and on_adopt when a move hands it another list's heap buffer.
+ * These hooks are empty, so they compile away entirely; see CountingListStats in
+ * list_stats.hpp for the recording policy.
+ */
+struct NoListStats {
+    void on_allocate(size_t /*capacity*/, size_t /*bytes*/) {}
+    void on_deallocate(size_t /*bytes*/) {}
+    void on_adopt(NoListStats& /*source*/, size_t /*bytes*/) {}
+    void on_reallocate(size_t /*relocated_elements*/) {}
+    void on_shift(size_t /*moved_elements*/) {}
+    void on_search(size_t /*probes*/) {}
+};
+
+template <typename T>
+class ListView;
+
+namespace list_detail {
+
+template <typename T>
+struct is_list_view : std::false_type {};
+
+template <typename T>
+struct is_list_view<ListView<T>> : std::true_type {};
+
+} // namespace list_detail
+
+/*!
+ * @brief Non-owning view of a contiguous range of elements: a pointer and a length.
+ *
+ * Views are cheap to copy and pass by value, and give functions a sub-range of a list
+ * without copying it. A view does not keep its elements alive and is invalidated by
+ * anything that reallocates the list it refers to, just like a List iterator.
+ *
+ * Any object with data() and length() members converts to a view, so a function taking
+ * ListView<const T> accepts List, SmallList, SortedList and other views alike.
+ *
+ * @tparam T The element type; const-qualify it for a read-only view.
+ */
+template <typename T>
+class ListView {
+public:
+    using value_type = std::remove_cv_t<T>;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using pointer = T*;
+    using iterator = T*;
+
+private:
+    T* elements;  ///< First element of the range
+    size_t count; ///< Number of elements in the range
+
+public:
+    /*!
+     * @defgroup ViewInitialization Initialization
+     * @{
+     */
+
+    /*!
+     * @brief Creates an empty view.
+     */
+    ListView() : elements(nullptr), count(0) {}
+
+    /*!
+     * @brief Creates a view of count elements starting at elements.
+     */
+    ListView(T* elements, size_t count) : elements(elements), count(count) {}
+
+    /*!
+     * @brief Converts a mutable view into a read-only one.
+     */
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    ListView(const ListView<U>& other) : elements(other.data()), count(other.length()) {}
+
+    /*!
+     * @brief Creates a view of a whole container (a List, SortedList, column, ...).
+     *
+     * @param container Any object whose data() converts to T* and that has length().
+     */
+    template <typename Container,
+              typename = std::enable_if_t<!list_detail::is_list_view<std::remove_cv_t<Container>>::value &&
+                                          std::is_convertible_v<decltype(std::declval<Container&>().data()), T*> &&
+                                          std::is_convertible_v<decltype(std::declval<Container&>().length()), size_t>>>
+    ListView(Container& container) : elements(container.data()), count(container.length()) {}
+
+    /*! @} */ // End of ViewInitialization group
+
+    /*!
+     * @defgroup ViewAccess Access and Slicing
+     * @{
+     */
+
+    /*!
+     * @brief Gets the number of elements in the view.
+     */
+    size_t length() const {
+        return count;
+    }
+
+    /*!
+     * @brief Checks if the view contains no elements.
+     */
+    bool is_empty() const {
+        return count == 0;
+    }
+
+    /*!
+     * @brief Gets a pointer to the first element.
+     */
+    T* data() const {
+        return elements;
+    }
+
+    /*!
+     * @brief Gets a reference to the element at the specified index, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    T& at(size_t index) const {
+        list_detail::check_index(index < count);
+        return elements[index];
+    }
+
+    /*!
+     * @brief Gets a reference to the element at the specified index (unchecked).
+     */
+    T& operator[](size_t index) const {
+        list_detail::debug_check_index(index < count);
+        return elements[index];
+    }
+
+    iterator begin() const {
+        return elements;
+    }
+
+    iterator end() const {
+        return elements + count;
+    }
+
+    /*!
+     * @brief Gets the view of elements [begin, end).
+     *
+     * @throw std::out_of_range if begin > end or end > length()
+     */
+    ListView slice(size_t begin, size_t end) const {
+        list_detail::check_index(begin <= end && end <= count);
+        return ListView(elements + begin, end - begin);
+    }
+
+    /*!
+     * @brief Gets the view of up to n elements starting at offset (fewer if the view ends first).
+     *
+     * @throw std::out_of_range if offset > length()
+     */
+    ListView subview(size_t offset, size_t n = static_cast<size_t>(-1)) const {
+        list_detail::check_index(offset <= count);
+        return ListView(elements + offset, std::min(n, count - offset));
+    }
+
+    /*! @} */ // End of ViewAccess group
+
+    /*!
+     * @defgroup ViewSearch Search Functions
+     * @{
+     */
+
+    /*!
+     * @brief Finds the index of the first element equal to value (SIMD-accelerated like List::index_of).
+     *
+     * @return The zero-based index within the view, or -1 if not found.
+     */
+    long index_of(const value_type& value) const {
+        return list_simd::find_first(static_cast<const value_type*>(elements), count, value);
+    }
+
+    /*!
+     * @brief Finds the index of the first element equal to any of the given values.
+     *
+     * @return The zero-based index within the view, or -1 if none matches.
+     */
+    template <typename... Values>
+    long index_of_any(const Values&... values) const {
+        static_assert(sizeof...(Values) > 0, "index_of_any needs at least one value");
+        const value_type keys[] = {static_cast<value_type>(values)...};
+        return list_simd::find_first_of(static_cast<const value_type*>(elements), count, keys, sizeof...(Values));
+    }
+
+    /*!
+     * @brief Counts the elements equal to value.
+     */
+    size_t count_of(const value_type& value) const {
+        return list_simd::count_equal(static_cast<const value_type*>(elements), count, value);
+    }
+
+    /*!
+     * @brief Checks if the view contains value.
+     */
+    bool contains(const value_type& value) const {
+        return index_of(value) >= 0;
+    }
+
+    /*!
+     * @brief Writes to out[i] the index of the first element equal to keys[i], or -1 (see List::index_of_many).
+     */
+    void index_of_many(const value_type* keys, size_t k, long* out,
+                       list_batch::Strategy strategy = list_batch::Strategy::automatic) const {
+        list_batch::index_of_many<value_type>(elements, count, keys, k, out, strategy);
+    }
+
+    /*!
+     * @brief Writes to out[i] whether the view contains keys[i] (see List::contains_many).
+     */
+    void contains_many(const value_type* keys, size_t k, bool* out,
+                       list_batch::Strategy strategy = list_batch::Strategy::automatic) const {
+        list_batch::contains_many<value_type>(elements, count, keys, k, out, strategy);
+    }
+
+    /*!
+     * @brief Finds the first position whose element is not ordered before value.
+     *
+     * The view must be sorted by comp. Uses the same branchless search as SortedList.
+     *
+     * @return An index in [0, length()].
+     */
+    template <typename Compare = std::less<value_type>>
+    size_t lower_bound(const value_type& value, const Compare& comp = Compare()) const {
+        return list_detail::branchless_lower_bound(static_cast<const value_type*>(elements), count, value, comp);
+    }
+
+    /*!
+     * @brief Finds the first position whose element is ordered after value.
+     *
+     * The view must be sorted by comp.
+     *
+     * @return An index in [0, length()].
+     */
+    template <typename Compare = std::less<value_type>>
+    size_t upper_bound(const value_type& value, const Compare& comp = Compare()) const {
+        return list_detail::branchless_upper_bound(static_cast<const value_type*>(elements), count, value, comp);
+    }
+
+    /*!
+     * @brief Checks in O(log n) whether a sorted view holds an element equivalent to value.
+     */
+    template <typename Compare = std::less<value_type>>
+    bool contains_sorted(const value_type& value, const Compare& comp = Compare()) const {
+        size_t index = lower_bound(value, comp);
+        return index < count && !comp(value, elements[index]);
+    }
+
+    /*! @} */ // End of ViewSearch group
+};
 
 /*!
  * @brief Represents a dynamically sized array (List) structure.
@@ -18,414 +543,1552 @@
  * where memory management can be done either internally (via constructor)
  * or externally (via init_static), making it suitable for both
  * general and embedded systems.
+ *
+ * Internal buffers are obtained from an std::allocator-compatible Allocator, so a list can
+ * be backed by an arena (e.g. std::pmr::monotonic_buffer_resource through pmr::List).
+ *
+ * @tparam T The element type.
+ * @tparam Allocator Allocator used for the internal buffer and element construction.
+ * @tparam Growth Policy picking the new capacity when the list is full (see Growth group).
+ * @tparam Stats Statistics policy notified of allocations, shifts and searches (see NoListStats).
  */
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>, typename Growth = GrowthDouble,
+          typename Stats = NoListStats>
 class List {
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+#ifdef LIST_DEBUG
+    template <bool Const>
+    class checked_iterator;
+    using iterator = checked_iterator<false>;
+    using const_iterator = checked_iterator<true>;
+#else
+    using iterator = T*;
+    using const_iterator = const T*;
+#endif
+
 private:
-    T* elements;         ///< Pointer to the data array (external or internal allocation)
-    size_t count;        ///< The current number of elements stored
-    size_t capacity;     ///< The maximum number of elements currently allocated for
-    bool is_dynamic;     ///< Flag to indicate if the list buffer (elements) was dynamically allocated
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same_v<typename alloc_traits::value_type, T>,
+                  "Allocator::value_type must be the list's element type");
+    static_assert(std::is_same_v<typename alloc_traits::pointer, T*>,
+                  "List requires an allocator that returns raw pointers");
+
+    T* elements;              ///< Pointer to the data array (external or internal allocation)
+    size_t count;             ///< The current number of elements stored
+    size_t capacity;          ///< The maximum number of elements currently allocated for
+    bool is_dynamic;          ///< Flag to indicate if the list buffer (elements) was dynamically allocated
+    bool is_inline;           ///< Flag to indicate the buffer is the inline storage of a SmallList
+    Allocator allocator;      ///< Source of the internal buffer
+    mutable Stats statistics; ///< Operation counters (empty unless a recording policy is chosen)
+#ifdef LIST_DEBUG
+    size_t generation = 0; ///< Bumped whenever the buffer changes, to detect stale iterators
+#endif
+
+    template <typename, size_t, typename, typename, typename>
+    friend class SmallList;
 
     /*!
-     * @brief Internal utility to resize the list's data buffer.
+     * @brief Tells whether the list constructs and destroys its elements itself.
      *
-     * Uses reallocation and doubles the capacity. This is common algorithm
-     * consolidated from the original add/insert functions.
+     * True for heap and inline buffers, which hold raw storage past count; false for
+     * caller-provided static buffers. These are also exactly the buffers that may grow.
+     */
+    bool manages_elements() const {
+        return is_dynamic || is_inline;
+    }
+
+    /*!
+     * @brief Marks every outstanding iterator stale after a buffer change (LIST_DEBUG only).
+     */
+    void invalidate_iterators() {
+#ifdef LIST_DEBUG
+        generation++;
+#endif
+    }
+
+    /*!
+     * @brief Overwrites n destroyed slots from first with list_detail::poison_byte (LIST_DEBUG only).
      *
-     * @param new_capacity The desired new capacity (must be >= count).
-     * @return true on success, false if reallocation fails.
+     * Static buffers are left alone, since their slots still hold the caller's objects.
      */
-    bool resize(size_t new_capacity) {
-        // If the list was initialized statically, we do not allow resizing
-        if (!is_dynamic) {
-            return false;
+    void poison_slots(size_t first, size_t n) {
+#ifdef LIST_DEBUG
+        if (manages_elements() && n > 0) {
+            std::memset(static_cast<void*>(elements + first), list_detail::poison_byte, n * sizeof(T));
+        }
+#else
+        (void)first;
+        (void)n;
+#endif
+    }
+
+    /*!
+     * @brief Allocates raw, uninitialized storage for n elements.
+     *
+     * @param n Number of elements to reserve room for.
+     * @return Pointer to the storage.
+     * @throw std::bad_alloc if memory allocation fails
+     */
+    T* allocate_storage(size_t n) {
+        T* buffer = alloc_traits::allocate(allocator, n);
+        statistics.on_allocate(n, n * sizeof(T));
+        return buffer;
+    }
+
+    /*!
+     * @brief Releases storage obtained from allocate_storage (elements must already be destroyed).
+     *
+     * @param buffer The storage to release (may be nullptr).
+     * @param n The element count the storage was allocated for.
+     */
+    void deallocate_storage(T* buffer, size_t n) {
+        if (buffer != nullptr) {
+#ifdef LIST_DEBUG
+            std::memset(static_cast<void*>(buffer), list_detail::poison_byte, n * sizeof(T));
+#endif
+            alloc_traits::deallocate(allocator, buffer, n);
+            statistics.on_deallocate(n * sizeof(T));
+        }
+    }
+
+    /*!
+     * @brief Constructs the element in slot index from args.
+     *
+     * Dynamic buffers hold raw storage past count, so the slot is constructed in place.
+     * Static buffers come from the caller as already-constructed objects, so the slot is assigned.
+     *
+     * @param index The slot to fill (normally count).
+     * @param args Constructor arguments for the element.
+     */
+    template <typename... Args>
+    void construct_slot(size_t index, Args&&... args) {
+        if (LIST_LIKELY(manages_elements())) {
+            alloc_traits::construct(allocator, elements + index, std::forward<Args>(args)...);
+        } else if constexpr (sizeof...(Args) == 1 && (std::is_assignable_v<T&, Args&&> && ...)) {
+            ((elements[index] = std::forward<Args>(args)), ...);
+        } else {
+            elements[index] = T(std::forward<Args>(args)...);
+        }
+    }
+
+    /*!
+     * @brief Ends the lifetime of the element in slot index (no-op for static buffers).
+     *
+     * @param index The slot to release.
+     */
+    void destroy_slot(size_t index) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            if (manages_elements()) {
+                alloc_traits::destroy(allocator, elements + index);
+            }
+        }
+        poison_slots(index, 1);
+    }
+
+    /*!
+     * @brief Destroys every stored element and resets count to zero.
+     */
+    void destroy_all() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            if (manages_elements()) {
+                for (size_t i = 0; i < count; ++i) {
+                    alloc_traits::destroy(allocator, elements + i);
+                }
+            }
+        }
+        poison_slots(0, count);
+        count = 0;
+    }
+
+    /*!
+     * @brief Destroys all elements and frees the buffer if the list owns it.
+     */
+    void release_storage() {
+        destroy_all();
+        if (LIST_LIKELY(is_dynamic)) {
+            deallocate_storage(elements, capacity);
+        }
+        elements = nullptr;
+        capacity = 0;
+        is_inline = false;
+        invalidate_iterators();
+    }
+
+    /*!
+     * @brief Switches to a freshly allocated heap buffer that already holds the elements.
+     *
+     * The previous buffer is freed if it was heap-allocated; inline storage is simply left.
+     *
+     * @param new_elements The new buffer, allocated from this list's allocator.
+     * @param new_capacity The capacity of the new buffer.
+     */
+    void adopt_heap_buffer(T* new_elements, size_t new_capacity) {
+        if (is_dynamic) {
+            deallocate_storage(elements, capacity);
+        }
+        elements = new_elements;
+        capacity = new_capacity;
+        is_dynamic = true;
+        is_inline = false;
+        invalidate_iterators();
+    }
+
+    /*!
+     * @brief Takes over other's elements; this list must be empty and hold no heap buffer.
+     *
+     * Heap and static buffers are transferred by pointer when the allocators allow it. Elements
+     * living in other's inline storage cannot be transferred, so they are relocated into this
+     * list's inline storage when they fit, or into a new heap buffer otherwise. On return other
+     * holds no elements and, unless it was inline, no buffer.
+     *
+     * @param other The list to take the elements from.
+     */
+    void take_contents(List& other) {
+        bool can_steal = other.is_dynamic ? (alloc_traits::is_always_equal::value ||
+                                             allocator == other.allocator)
+                                          : !other.is_inline;
+        if (can_steal) {
+            if (other.is_dynamic && other.elements != nullptr) {
+                statistics.on_adopt(other.statistics, other.capacity * sizeof(T));
+            }
+            elements = other.elements;
+            count = other.count;
+            capacity = other.capacity;
+            is_dynamic = other.is_dynamic;
+            is_inline = false;
+
+            // Reset the source object
+            other.elements = nullptr;
+            other.count = 0;
+            other.capacity = 0;
+            other.is_dynamic = true;
+            other.is_inline = false;
+            other.invalidate_iterators();
+            invalidate_iterators();
+            return;
+        }
+
+        if (other.count > capacity) {
+            adopt_heap_buffer(allocate_storage(other.count), other.count);
+            statistics.on_reallocate(other.count);
+        }
+        list_detail::relocate(allocator, elements, other.elements, other.count);
+        count = other.count;
+        other.count = 0;
+        if (!other.is_inline) {
+            other.release_storage();
+        }
+    }
+
+    /*!
+     * @brief Computes the capacity to grow to, as chosen by the growth policy.
+     *
+     * @param required The minimum capacity needed (defaults to room for one more element).
+     */
+    size_t grown_capacity(size_t required = 0) const {
+        if (required == 0) {
+            required = count + 1;
+        }
+        return Growth::grow(capacity, required, sizeof(T));
+    }
+
+    /*!
+     * @brief Makes room for n more elements, growing once by the growth policy if needed.
+     *
+     * @param n Number of elements about to be added.
+     * @throw std::runtime_error if the list cannot grow or reallocation fails
+     */
+    void reserve_for(size_t n) {
+        if (n > capacity - count) {
+            if (!resize(grown_capacity(count + n))) {
+                throw std::runtime_error("Failed to reallocate memory for list expansion");
+            }
+        }
+    }
+
+    /*!
+     * @brief Internal utility to resize the list's data buffer.
+     *
+     * Allocates uninitialized storage and relocates the existing elements into it
+     * (memcpy for trivially relocatable types, move construction otherwise), so no
+     * element is copied and no unused slot is constructed.
+     *
+     * @param new_capacity The desired new capacity (must be >= count).
+     * @return true on success, false if reallocation fails.
+     */
+    bool resize(size_t new_capacity) {
+        // If the list was initialized statically, we do not allow resizing
+        if (!manages_elements()) {
+            return false;
+        }
+
+        if (new_capacity < count) {
+            return false;
+        }
+
+        // Attempt to allocate raw memory for the data array
+        T* new_elements = nullptr;
+        try {
+            new_elements = allocate_storage(new_capacity);
+        } catch (const std::bad_alloc&) {
+            return false;
+        }
+
+        // Relocate existing elements to new array
+        try {
+            list_detail::relocate(allocator, new_elements, elements, count);
+        } catch (...) {
+            deallocate_storage(new_elements, new_capacity);
+            throw;
+        }
+
+        if (capacity > 0) {
+            statistics.on_reallocate(count); // The first buffer of an empty list is not a reallocation
+        }
+        adopt_heap_buffer(new_elements, new_capacity);
+        return true;
+    }
+
+    /*!
+     * @brief Grows the buffer and constructs one new element at the end.
+     *
+     * The new element is built in the new buffer before the old elements are relocated,
+     * so arguments that refer to elements of this list stay valid.
+     *
+     * @param args Constructor arguments for the new element.
+     * @throw std::runtime_error if list is static or memory reallocation fails
+     */
+    template <typename... Args>
+    void grow_and_emplace_back(Args&&... args) {
+        if (!manages_elements()) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+
+        size_t new_capacity = grown_capacity();
+        T* new_elements = nullptr;
+        try {
+            new_elements = allocate_storage(new_capacity);
+        } catch (const std::bad_alloc&) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+
+        try {
+            alloc_traits::construct(allocator, new_elements + count, std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate_storage(new_elements, new_capacity);
+            throw;
+        }
+
+        try {
+            list_detail::relocate(allocator, new_elements, elements, count);
+        } catch (...) {
+            alloc_traits::destroy(allocator, new_elements + count);
+            deallocate_storage(new_elements, new_capacity);
+            throw;
+        }
+
+        if (capacity > 0) {
+            statistics.on_reallocate(count);
+        }
+        adopt_heap_buffer(new_elements, new_capacity);
+        count++;
+    }
+
+public:
+    /*!
+     * @defgroup Initialization Initialization and Destruction Functions
+     * @{
+     */
+
+    /*!
+     * @brief Default constructor that creates an empty list with zero capacity.
+     */
+    List() : elements(nullptr), count(0), capacity(0), is_dynamic(true), is_inline(false), allocator() {}
+
+    /*!
+     * @brief Creates an empty list with zero capacity that will allocate from alloc.
+     *
+     * @param alloc The allocator to copy into the list.
+     */
+    explicit List(const Allocator& alloc)
+        : elements(nullptr), count(0), capacity(0), is_dynamic(true), is_inline(false), allocator(alloc) {}
+
+    /*!
+     * @brief Constructs and initializes a new List with dynamic memory allocation.
+     *
+     * @param capacity The initial maximum number of elements the list can hold. Must be > 0.
+     * @param alloc The allocator to copy into the list.
+     * @throw std::invalid_argument if capacity is 0
+     * @throw std::bad_alloc if memory allocation fails
+     */
+    explicit List(size_t capacity, const Allocator& alloc = Allocator())
+        : count(0), capacity(capacity), is_dynamic(true), is_inline(false), allocator(alloc) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Capacity must be greater than 0");
+        }
+
+        elements = allocate_storage(capacity);
+    }
+
+    /*!
+     * @brief Destructor that frees the memory associated with the List and its data buffer.
+     *
+     * This is automatically called when the List object goes out of scope.
+     * It safely handles both dynamically and statically allocated buffers.
+     */
+    ~List() {
+        release_storage();
+    }
+
+    /*!
+     * @brief Initializes a List using a pre-allocated static/stack buffer.
+     *
+     * This function allows memory control outside of dynamic allocation, preferred in strict embedded environments.
+     * The list will not resize itself. The buffer slots are treated as objects owned by the
+     * caller: the list assigns into them and never constructs or destroys them.
+     *
+     * @param buffer Pointer to the pre-allocated data buffer.
+     * @param capacity The maximum size of the buffer in elements.
+     */
+    void init_static(T* buffer, size_t capacity) {
+        release_storage();
+
+        elements = buffer;
+        this->count = 0;
+        this->capacity = capacity;
+        this->is_dynamic = false;
+    }
+
+    /*!
+     * @brief Initializes a List over an external buffer that already holds count elements.
+     *
+     * Adopts the elements in place, without copying, e.g. a frame just received from the
+     * network. The buffer stays owned by the caller, as with init_static(buffer, capacity).
+     *
+     * @param buffer Pointer to the pre-allocated data buffer.
+     * @param capacity The maximum size of the buffer in elements.
+     * @param count The number of elements already stored at the start of the buffer.
+     * @throw std::invalid_argument if count exceeds capacity
+     */
+    void init_static(T* buffer, size_t capacity, size_t count) {
+        if (count > capacity) {
+            throw std::invalid_argument("Count must not exceed capacity");
+        }
+        init_static(buffer, capacity);
+        this->count = count;
+    }
+
+    /*! @} */ // End of Initialization group
+
+    /*!
+     * @defgroup Information Basic Information Functions
+     * @{
+     */
+
+    /*!
+     * @brief Gets the current number of elements in the list.
+     * @return The current number of elements.
+     */
+    size_t length() const {
+        return count;
+    }
+
+    /*!
+     * @brief Gets the current capacity of the list.
+     * @return The maximum number of elements currently allocated for.
+     */
+    size_t get_capacity() const {
+        return capacity;
+    }
+
+    /*!
+     * @brief Checks if the list contains no elements.
+     *
+     * @return true if the list is empty (count is 0), false otherwise.
+     */
+    bool is_empty() const {
+        return count == 0;
+    }
+
+    /*!
+     * @brief Returns whether the list uses dynamic memory allocation.
+     *
+     * @return true if the list buffer was dynamically allocated, false otherwise.
+     */
+    bool is_dynamic_allocation() const {
+        return is_dynamic;
+    }
+
+    /*!
+     * @brief Returns a copy of the allocator used by the list.
+     *
+     * @return The list's allocator.
+     */
+    Allocator get_allocator() const {
+        return allocator;
+    }
+
+    /*!
+     * @brief Gives access to the list's statistics policy object.
+     *
+     * With the default NoListStats this is an empty object; with CountingListStats it holds
+     * the counters of this list.
+     *
+     * @return The statistics object.
+     */
+    Stats& stats() const {
+        return statistics;
+    }
+
+    /*! @} */ // End of Information group
+
+    /*!
+     * @defgroup Capacity Capacity Management
+     * @{
+     */
+
+    /*!
+     * @brief Ensures the list can hold at least new_capacity elements without reallocating.
+     *
+     * Grows to exactly new_capacity (the growth policy is not applied), so a list can be
+     * pre-sized from a known batch size. Does nothing if the capacity is already large enough.
+     *
+     * @param new_capacity The minimum capacity required.
+     * @throw std::runtime_error if the list cannot grow (static buffer) or reallocation fails
+     */
+    void reserve(size_t new_capacity) {
+        if (new_capacity <= capacity) {
+            return;
+        }
+        if (!resize(new_capacity)) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+    }
+
+    /*!
+     * @brief Reduces a heap buffer's capacity to the number of stored elements.
+     *
+     * An empty list releases its buffer entirely. Static buffers are left untouched, and an
+     * allocation failure simply keeps the current buffer.
+     */
+    void shrink_to_fit() {
+        if (!is_dynamic || count == capacity) {
+            return;
+        }
+        if (count == 0) {
+            deallocate_storage(elements, capacity);
+            elements = nullptr;
+            capacity = 0;
+            invalidate_iterators();
+            return;
+        }
+        resize(count);
+    }
+
+    /*! @} */ // End of Capacity group
+
+    /*!
+     * @defgroup Access Element Access and Modification
+     * @{
+     */
+
+    /*!
+     * @brief Gets a pointer to the element at the specified index.
+     *
+     * The return value is a direct pointer into the internal array.
+     *
+     * @param index The zero-based index of the element to retrieve.
+     * @return A pointer to the element.
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    T* get_element(size_t index) {
+        list_detail::check_index(index < count);
+        return &elements[index];
+    }
+
+    /*!
+     * @brief Gets a const pointer to the element at the specified index.
+     *
+     * @param index The zero-based index of the element to retrieve.
+     * @return A const pointer to the element.
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    const T* get_element(size_t index) const {
+        list_detail::check_index(index < count);
+        return &elements[index];
+    }
+
+    /*!
+     * @brief Gets a reference to the element at the specified index, with bounds checking.
+     *
+     * @param index The zero-based index of the element to retrieve.
+     * @return A reference to the element.
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    T& at(size_t index) {
+        list_detail::check_index(index < count);
+        return elements[index];
+    }
+
+    /*!
+     * @brief Gets a const reference to the element at the specified index, with bounds checking.
+     *
+     * @param index The zero-based index of the element to retrieve.
+     * @return A const reference to the element.
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    const T& at(size_t index) const {
+        list_detail::check_index(index < count);
+        return elements[index];
+    }
+
+    /*!
+     * @brief Gets a reference to the element at the specified index without any check
+     * (checked only when LIST_DEBUG is defined).
+     *
+     * @param index The zero-based index of the element to retrieve. Must be < length().
+     * @return A reference to the element.
+     */
+    T& at_unchecked(size_t index) {
+        list_detail::debug_check_index(index < count);
+        return elements[index];
+    }
+
+    /*!
+     * @brief Gets a const reference to the element at the specified index without any check
+     * (checked only when LIST_DEBUG is defined).
+     *
+     * @param index The zero-based index of the element to retrieve. Must be < length().
+     * @return A const reference to the element.
+     */
+    const T& at_unchecked(size_t index) const {
+        list_detail::debug_check_index(index < count);
+        return elements[index];
+    }
+
+    /*!
+     * @brief Sets the value of the element at the specified index.
+     *
+     * @param index The zero-based index of the element to modify.
+     * @param value The new value to set.
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    void set_element(size_t index, const T& value) {
+        list_detail::check_index(index < count);
+        elements[index] = value;
+    }
+
+    /*!
+     * @brief Resets the list's element count to zero, effectively clearing it.
+     *
+     * Stored elements are destroyed; the allocated memory buffer remains intact.
+     */
+    void clear() {
+        destroy_all();
+    }
+
+    /*! @} */ // End of Access group
+
+    /*!
+     * @defgroup Manipulation Element Manipulation Functions
+     * @{
+     */
+
+    /*!
+     * @brief Constructs a new element in place at the end of the list.
+     *
+     * If capacity is reached, it grows the buffer as the growth policy dictates (if dynamically allocated).
+     * Growth relocates the existing elements instead of copying them.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return A reference to the new element.
+     * @throw std::runtime_error if list is invalid or memory reallocation fails
+     */
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        // Check for capacity and grow if needed
+        if (LIST_UNLIKELY(count >= capacity)) {
+            grow_and_emplace_back(std::forward<Args>(args)...);
+        } else {
+            construct_slot(count, std::forward<Args>(args)...);
+            count++;
+        }
+        return elements[count - 1];
+    }
+
+    /*!
+     * @brief Adds a new element to the end of the list.
+     *
+     * If capacity is reached, it grows the buffer as the growth policy dictates (if dynamically allocated).
+     * Growth relocates the existing elements instead of copying them.
+     *
+     * @param element The element to add.
+     * @throw std::runtime_error if list is invalid or memory reallocation fails
+     */
+    void add(const T& element) {
+        emplace(element);
+    }
+
+    /*!
+     * @brief Adds a new element to the end of the list by moving it.
+     *
+     * @param element The element to move into the list.
+     * @throw std::runtime_error if list is invalid or memory reallocation fails
+     */
+    void add(T&& element) {
+        emplace(std::move(element));
+    }
+
+    /*!
+     * @brief Constructs a new element at the specified index, shifting subsequent elements right.
+     *
+     * Appending (index == length()) constructs directly in the buffer. For other positions the
+     * element is built first and then moved into the gap, because the arguments may refer to
+     * elements that the shift is about to move.
+     *
+     * @param index The index where the new element should be placed. Must be <= length().
+     * @param args Arguments forwarded to the constructor of T.
+     * @return A reference to the new element.
+     * @throw std::out_of_range if index is out of bounds
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    template <typename... Args>
+    T& emplace_at(size_t index, Args&&... args) {
+        list_detail::check_index(index <= count);
+
+        if (index == count) {
+            return emplace(std::forward<Args>(args)...);
+        }
+
+        T value(std::forward<Args>(args)...);
+
+        // Check for capacity and resize if needed
+        if (count >= capacity) {
+            if (!resize(grown_capacity())) {
+                throw std::runtime_error("Failed to reallocate memory for list expansion");
+            }
+        }
+
+        // Shift elements to the right to make space
+        statistics.on_shift(count - index);
+        construct_slot(count, std::move(elements[count - 1]));
+        std::move_backward(elements + index, elements + count - 1, elements + count);
+
+        // Insert new element
+        elements[index] = std::move(value);
+        count++;
+        return elements[index];
+    }
+
+    /*!
+     * @brief Inserts a new element at the specified index, shifting subsequent elements right.
+     *
+     * If capacity is reached, it grows the buffer as the growth policy dictates (if dynamically allocated).
+     *
+     * @param index The index where the new element should be inserted. Must be <= length().
+     * @param element The element to insert.
+     * @throw std::out_of_range if index is out of bounds
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void insert(size_t index, const T& element) {
+        emplace_at(index, element);
+    }
+
+    /*!
+     * @brief Inserts a new element at the specified index by moving it.
+     *
+     * @param index The index where the new element should be inserted. Must be <= length().
+     * @param element The element to move into the list.
+     * @throw std::out_of_range if index is out of bounds
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void insert(size_t index, T&& element) {
+        emplace_at(index, std::move(element));
+    }
+
+    /*!
+     * @brief Removes the element at the specified index, shifting subsequent elements left.
+     *
+     * Does not reduce the list's capacity.
+     *
+     * @param index The index of the element to remove. Must be < length().
+     * @throw std::out_of_range if index is out of bounds
+     */
+    void remove_at(size_t index) {
+        list_detail::check_index(index < count);
+
+        // Shift elements to the left to close gap
+        statistics.on_shift(count - index - 1);
+        std::move(elements + index + 1, elements + count, elements + index);
+
+        destroy_slot(count - 1);
+        count--;
+    }
+
+    /*!
+     * @brief Removes the element at the specified index in O(1) by moving the last element into its place.
+     *
+     * The order of the remaining elements is not preserved. Does not reduce the list's capacity.
+     *
+     * @param index The index of the element to remove. Must be < length().
+     * @throw std::out_of_range if index is out of bounds
+     */
+    void swap_remove(size_t index) {
+        list_detail::check_index(index < count);
+
+        if (index != count - 1) {
+            elements[index] = std::move(elements[count - 1]);
+        }
+
+        destroy_slot(count - 1);
+        count--;
+    }
+
+    /*!
+     * @brief Appends n elements copied from a contiguous array.
+     *
+     * The buffer grows at most once and the batch is copied in one go (a single memcpy
+     * for trivially copyable types). The source may point into this list.
+     *
+     * @param first Pointer to the first element to copy.
+     * @param n Number of elements to copy.
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void append(const T* first, size_t n) {
+        if (n == 0) {
+            return;
+        }
+
+        if (n > capacity - count) {
+            bool aliases = std::less_equal<const T*>()(elements, first) &&
+                           std::less<const T*>()(first, elements + count);
+            size_t offset = aliases ? static_cast<size_t>(first - elements) : 0;
+            if (!resize(grown_capacity(count + n))) {
+                throw std::runtime_error("Failed to reallocate memory for list expansion");
+            }
+            if (aliases) {
+                first = elements + offset;
+            }
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            std::memcpy(static_cast<void*>(elements + count), static_cast<const void*>(first), n * sizeof(T));
+            count += n;
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                construct_slot(count, first[i]);
+                count++;
+            }
+        }
+    }
+
+    /*!
+     * @brief Extends the list by n slots whose contents the caller then writes directly.
+     *
+     * Lets readers (files, sockets, decoders) fill the buffer in place instead of staging the
+     * data and copying it in with append. The new slots hold indeterminate values until written.
+     *
+     * @param n Number of elements to add.
+     * @return Pointer to the first new slot (valid until the list next grows).
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    T* append_uninitialized(size_t n) {
+        static_assert(std::is_trivially_copyable_v<T>, "append_uninitialized requires a trivially copyable type");
+        reserve_for(n);
+        T* slots = elements + count;
+        count += n;
+        return slots;
+    }
+
+    /*!
+     * @brief Moves every element of other to the end of this list, leaving other empty.
+     *
+     * If this list is empty the whole buffer is taken over when possible; otherwise the
+     * elements are relocated in one block after a single growth.
+     *
+     * @param other The list whose elements are moved.
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void append(List&& other) {
+        if (this == &other || other.count == 0) {
+            return;
+        }
+
+        if (count == 0 && !is_inline && is_dynamic && other.is_dynamic &&
+            (alloc_traits::is_always_equal::value || allocator == other.allocator)) {
+            release_storage();
+            take_contents(other);
+            return;
+        }
+
+        reserve_for(other.count);
+        if (manages_elements() && other.manages_elements()) {
+            list_detail::relocate(allocator, elements + count, other.elements, other.count);
+            count += other.count;
+            other.count = 0;
+        } else {
+            for (size_t i = 0; i < other.count; ++i) {
+                construct_slot(count, std::move(other.elements[i]));
+                count++;
+            }
+            other.destroy_all();
+        }
+    }
+
+    /*!
+     * @brief Inserts copies of the range [first, last) before index.
+     *
+     * The buffer grows at most once, the tail is shifted once by the range length (memmove
+     * for trivially copyable types), and the batch is copied into the gap. The range must
+     * not refer to elements of this list.
+     *
+     * @tparam ForwardIt A forward iterator whose value converts to T.
+     * @param index The position of the first inserted element. Must be <= length().
+     * @param first Start of the range to insert.
+     * @param last End of the range to insert.
+     * @throw std::out_of_range if index is out of bounds
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    template <typename ForwardIt>
+    void insert_range(size_t index, ForwardIt first, ForwardIt last) {
+        list_detail::check_index(index <= count);
+
+        size_t n = static_cast<size_t>(std::distance(first, last));
+        if (n == 0) {
+            return;
+        }
+        reserve_for(n);
+
+        size_t tail = count - index;
+        statistics.on_shift(tail);
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            std::memmove(static_cast<void*>(elements + index + n), static_cast<const void*>(elements + index),
+                         tail * sizeof(T));
+            std::copy(first, last, elements + index);
+            count += n;
+        } else if (n <= tail) {
+            // The last n tail elements move into raw slots; the rest shifts within live ones
+            for (size_t i = count - n; i < count; ++i) {
+                construct_slot(i + n, std::move(elements[i]));
+            }
+            size_t old_count = count;
+            count += n;
+            std::move_backward(elements + index, elements + old_count - n, elements + old_count);
+            std::copy(first, last, elements + index);
+        } else {
+            // Part of the range lands in raw slots, followed by the whole relocated tail
+            ForwardIt mid = first;
+            std::advance(mid, tail);
+            for (ForwardIt it = mid; it != last; ++it) {
+                construct_slot(count, *it);
+                count++;
+            }
+            for (size_t i = index; i < index + tail; ++i) {
+                construct_slot(count, std::move(elements[i]));
+                count++;
+            }
+            std::copy(first, mid, elements + index);
+        }
+    }
+
+    /*!
+     * @brief Removes the elements in the index range [begin, end), shifting the tail left once.
+     *
+     * Does not reduce the list's capacity.
+     *
+     * @param begin Index of the first element to remove.
+     * @param end One past the index of the last element to remove. Must be <= length().
+     * @throw std::out_of_range if begin > end or end > length()
+     */
+    void remove_range(size_t begin, size_t end) {
+        list_detail::check_index(begin <= end && end <= count);
+        if (begin == end) {
+            return;
+        }
+
+        // Shift the tail left over the removed block
+        statistics.on_shift(count - end);
+        std::move(elements + end, elements + count, elements + begin);
+
+        size_t new_count = count - (end - begin);
+        for (size_t i = new_count; i < count; ++i) {
+            destroy_slot(i);
+        }
+        count = new_count;
+    }
+
+    /*! @} */ // End of Manipulation group
+
+    /*!
+     * @defgroup Search Search Functions
+     * @{
+     */
+
+    /*!
+     * @brief Finds the index of the first occurrence of a matching value.
+     *
+     * Comparison is done using operator== for the type T. Arithmetic, enum and pointer
+     * elements are compared with SIMD instructions (see list_simd.hpp).
+     *
+     * @param value The value to search for.
+     * @return The zero-based index of the found element, or -1 if not found.
+     */
+    long index_of(const T& value) const {
+        long found = list_simd::find_first(elements, count, value);
+        statistics.on_search(found < 0 ? count : static_cast<size_t>(found) + 1);
+        return found;
+    }
+
+    /*!
+     * @brief Finds the index of the first element equal to any of the given values.
+     *
+     * All values are tested in a single pass over the list.
+     *
+     * @param values The values to search for (each converted to T).
+     * @return The zero-based index of the first matching element, or -1 if none matches.
+     */
+    template <typename... Values>
+    long index_of_any(const Values&... values) const {
+        static_assert(sizeof...(Values) > 0, "index_of_any needs at least one value");
+        const T keys[] = {static_cast<T>(values)...};
+        long found = list_simd::find_first_of(elements, count, keys, sizeof...(Values));
+        statistics.on_search(found < 0 ? count : static_cast<size_t>(found) + 1);
+        return found;
+    }
+
+    /*!
+     * @brief Counts the elements equal to value.
+     *
+     * @param value The value to count.
+     * @return The number of matching elements.
+     */
+    size_t count_of(const T& value) const {
+        statistics.on_search(count);
+        return list_simd::count_equal(elements, count, value);
+    }
+
+    /*!
+     * @brief Checks if the list contains a specific value.
+     *
+     * @param value The value to check for.
+     * @return true if the element is found, false otherwise.
+     */
+    bool contains(const T& value) const {
+        return index_of(value) >= 0;
+    }
+
+    /*!
+     * @brief Looks up a batch of keys, writing to out[i] the index of the first element equal
+     * to keys[i], or -1.
+     *
+     * Much cheaper than k calls to index_of: the batch is answered with cache-blocked SIMD
+     * scans, a temporary hash set of the keys or a sorted copy of them, chosen from k, the list
+     * length and what T supports unless a strategy is given (see list_batch.hpp). The scan
+     * stops once every key has been found.
+     *
+     * @param keys The values to search for.
+     * @param k Number of keys.
+     * @param out Receives k indices.
+     * @param strategy Search strategy; automatic by default.
+     * @throw std::bad_alloc if the temporary key table cannot be allocated
+     */
+    void index_of_many(const T* keys, size_t k, long* out,
+                       list_batch::Strategy strategy = list_batch::Strategy::automatic) const {
+        statistics.on_search(count);
+        list_batch::index_of_many<T>(elements, count, keys, k, out, strategy);
+    }
+
+    /*!
+     * @brief Looks up a batch of keys, writing to out[i] whether the list contains keys[i].
+     *
+     * @param keys The values to search for.
+     * @param k Number of keys.
+     * @param out Receives k flags.
+     * @param strategy Search strategy; automatic by default (see index_of_many).
+     * @throw std::bad_alloc if the temporary key table cannot be allocated
+     */
+    void contains_many(const T* keys, size_t k, bool* out,
+                       list_batch::Strategy strategy = list_batch::Strategy::automatic) const {
+        statistics.on_search(count);
+        list_batch::contains_many<T>(elements, count, keys, k, out, strategy);
+    }
+
+    /*! @} */ // End of Search group
+
+    /*!
+     * @brief Overloaded array subscript operator for element access.
+     *
+     * Not bounds-checked, so it compiles to a plain load in tight loops. Define LIST_DEBUG
+     * to turn on the check; use at() when a checked access is always wanted.
+     *
+     * @param index The zero-based index of the element to retrieve. Must be < length().
+     * @return A reference to the element at the specified index.
+     */
+    T& operator[](size_t index) {
+        list_detail::debug_check_index(index < count);
+        return elements[index];
+    }
+
+    /*!
+     * @brief Overloaded const array subscript operator for element access.
+     *
+     * Not bounds-checked unless LIST_DEBUG is defined.
+     *
+     * @param index The zero-based index of the element to retrieve. Must be < length().
+     * @return A const reference to the element at the specified index.
+     */
+    const T& operator[](size_t index) const {
+        list_detail::debug_check_index(index < count);
+        return elements[index];
+    }
+
+    /*!
+     * @defgroup Iteration Iteration and Raw Access
+     * @{
+     */
+
+    /*!
+     * @brief Gets a pointer to the first element (the contiguous buffer).
+     *
+     * @return Pointer to the buffer; may be nullptr for an empty list.
+     */
+    T* data() {
+        return elements;
+    }
+
+    /*!
+     * @brief Gets a const pointer to the first element (the contiguous buffer).
+     *
+     * @return Const pointer to the buffer; may be nullptr for an empty list.
+     */
+    const T* data() const {
+        return elements;
+    }
+
+#ifdef LIST_DEBUG
+    /*!
+     * @brief Iterator of LIST_DEBUG builds, checking on every access that its list still uses
+     * the buffer it was created for and that it points at an element.
+     *
+     * @throw std::logic_error when used after the list changed buffers
+     * @throw std::out_of_range when dereferenced outside [begin, end)
+     */
+    template <bool Const>
+    class checked_iterator {
+        using owner_type = std::conditional_t<Const, const List, List>;
+        using element_type = std::conditional_t<Const, const T, T>;
+
+        owner_type* owner = nullptr;      ///< The list iterated over
+        element_type* position = nullptr; ///< The current element
+        size_t generation = 0;            ///< owner->generation when the iterator was created
+
+        template <bool>
+        friend class checked_iterator;
+        friend class List;
+
+        checked_iterator(owner_type* owner, element_type* position)
+            : owner(owner), position(position), generation(owner->generation) {}
+
+        void check_valid() const {
+            if (owner == nullptr || generation != owner->generation) {
+                throw std::logic_error("List iterator used after the list changed buffers");
+            }
+        }
+
+        element_type* checked_element() const {
+            check_valid();
+            list_detail::check_index(position >= owner->elements && position < owner->elements + owner->count);
+            return position;
+        }
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = element_type*;
+        using reference = element_type&;
+
+        checked_iterator() = default;
+
+        /*!
+         * @brief Converts an iterator into a const_iterator.
+         */
+        template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        checked_iterator(const checked_iterator<OtherConst>& other)
+            : owner(other.owner), position(other.position), generation(other.generation) {}
+
+        /*!
+         * @brief Converts to the raw element pointer, as the T* iterators of other builds are.
+         */
+        operator pointer() const {
+            check_valid();
+            return position;
+        }
+
+        reference operator*() const {
+            return *checked_element();
+        }
+
+        pointer operator->() const {
+            return checked_element();
+        }
+
+        reference operator[](difference_type n) const {
+            return *(*this + n);
+        }
+
+        checked_iterator& operator++() {
+            ++position;
+            return *this;
+        }
+
+        checked_iterator operator++(int) {
+            checked_iterator previous = *this;
+            ++position;
+            return previous;
+        }
+
+        checked_iterator& operator--() {
+            --position;
+            return *this;
+        }
+
+        checked_iterator operator--(int) {
+            checked_iterator previous = *this;
+            --position;
+            return previous;
+        }
+
+        checked_iterator& operator+=(difference_type n) {
+            position += n;
+            return *this;
+        }
+
+        checked_iterator& operator-=(difference_type n) {
+            position -= n;
+            return *this;
+        }
+
+        friend checked_iterator operator+(checked_iterator it, difference_type n) {
+            return it += n;
+        }
+
+        friend checked_iterator operator+(difference_type n, checked_iterator it) {
+            return it += n;
         }
 
-        if (new_capacity < count) {
-            return false;
+        friend checked_iterator operator-(checked_iterator it, difference_type n) {
+            return it -= n;
         }
 
-        // Attempt to reallocate memory for the data array
-        T* new_elements = new (std::nothrow) T[new_capacity];
-        if (new_elements == nullptr) {
-            return false;
+        friend difference_type operator-(const checked_iterator& a, const checked_iterator& b) {
+            return a.position - b.position;
         }
 
-        // Copy existing elements to new array
-        for (size_t i = 0; i < count; ++i) {
-            new_elements[i] = elements[i];
+        friend bool operator==(const checked_iterator& a, const checked_iterator& b) {
+            return a.position == b.position;
         }
 
-        // Delete old array if it was dynamically allocated
-        if (is_dynamic && elements != nullptr) {
-            delete[] elements;
+        friend bool operator!=(const checked_iterator& a, const checked_iterator& b) {
+            return a.position != b.position;
         }
 
-        elements = new_elements;
-        capacity = new_capacity;
-        return true;
-    }
+        friend bool operator<(const checked_iterator& a, const checked_iterator& b) {
+            return a.position < b.position;
+        }
 
-public:
-    /*!
-     * @defgroup Initialization Initialization and Destruction Functions
-     * @{
-     */
+        friend bool operator>(const checked_iterator& a, const checked_iterator& b) {
+            return a.position > b.position;
+        }
 
-    /*!
-     * @brief Default constructor that creates an empty list with zero capacity.
-     */
-    List() : elements(nullptr), count(0), capacity(0), is_dynamic(true) {}
+        friend bool operator<=(const checked_iterator& a, const checked_iterator& b) {
+            return a.position <= b.position;
+        }
 
-    /*!
-     * @brief Constructs and initializes a new List with dynamic memory allocation.
-     *
-     * @param capacity The initial maximum number of elements the list can hold. Must be > 0.
-     * @throw std::invalid_argument if capacity is 0
-     * @throw std::bad_alloc if memory allocation fails
-     */
-    explicit List(size_t capacity) : count(0), capacity(capacity), is_dynamic(true) {
-        if (capacity == 0) {
-            throw std::invalid_argument("Capacity must be greater than 0");
+        friend bool operator>=(const checked_iterator& a, const checked_iterator& b) {
+            return a.position >= b.position;
         }
+    };
 
-        elements = new T[capacity];
+private:
+    iterator make_iterator(T* position) {
+        return iterator(this, position);
     }
 
-    /*!
-     * @brief Destructor that frees the memory associated with the List and its data buffer.
-     *
-     * This is automatically called when the List object goes out of scope.
-     * It safely handles both dynamically and statically allocated buffers.
-     */
-    ~List() {
-        if (is_dynamic && elements != nullptr) {
-            delete[] elements;
-        }
-        elements = nullptr;
+    const_iterator make_iterator(const T* position) const {
+        return const_iterator(this, position);
     }
 
-    /*!
-     * @brief Initializes a List using a pre-allocated static/stack buffer.
-     *
-     * This function allows memory control outside of dynamic allocation, preferred in strict embedded environments.
-     * The list will not resize itself.
-     *
-     * @param buffer Pointer to the pre-allocated data buffer.
-     * @param capacity The maximum size of the buffer in elements.
-     */
-    void init_static(T* buffer, size_t capacity) {
-        if (is_dynamic && elements != nullptr) {
-            delete[] elements;
-        }
+public:
+#else
+private:
+    iterator make_iterator(T* position) {
+        return position;
+    }
 
-        elements = buffer;
-        this->count = 0;
-        this->capacity = capacity;
-        this->is_dynamic = false;
+    const_iterator make_iterator(const T* position) const {
+        return position;
     }
 
-    /*! @} */ // End of Initialization group
+public:
+#endif
 
     /*!
-     * @defgroup Information Basic Information Functions
-     * @{
+     * @brief Gets an iterator to the first element. Iterators are invalidated by any growth.
      */
+    iterator begin() {
+        return make_iterator(elements);
+    }
 
     /*!
-     * @brief Gets the current number of elements in the list.
-     * @return The current number of elements.
+     * @brief Gets an iterator one past the last element.
      */
-    size_t length() const {
-        return count;
+    iterator end() {
+        return make_iterator(elements + count);
     }
 
     /*!
-     * @brief Gets the current capacity of the list.
-     * @return The maximum number of elements currently allocated for.
+     * @brief Gets a const iterator to the first element.
      */
-    size_t get_capacity() const {
-        return capacity;
+    const_iterator begin() const {
+        return make_iterator(static_cast<const T*>(elements));
     }
 
     /*!
-     * @brief Checks if the list contains no elements.
-     *
-     * @return true if the list is empty (count is 0), false otherwise.
+     * @brief Gets a const iterator one past the last element.
      */
-    bool is_empty() const {
-        return count == 0;
+    const_iterator end() const {
+        return make_iterator(static_cast<const T*>(elements + count));
     }
 
     /*!
-     * @brief Returns whether the list uses dynamic memory allocation.
-     *
-     * @return true if the list buffer was dynamically allocated, false otherwise.
+     * @brief Gets a const iterator to the first element.
      */
-    bool is_dynamic_allocation() const {
-        return is_dynamic;
+    const_iterator cbegin() const {
+        return begin();
     }
 
-    /*! @} */ // End of Information group
-
     /*!
-     * @defgroup Access Element Access and Modification
-     * @{
+     * @brief Gets a const iterator one past the last element.
      */
+    const_iterator cend() const {
+        return end();
+    }
 
     /*!
-     * @brief Gets a pointer to the element at the specified index.
-     *
-     * The return value is a direct pointer into the internal array.
-     *
-     * @param index The zero-based index of the element to retrieve.
-     * @return A pointer to the element.
-     * @throw std::out_of_range if the index is out of bounds
+     * @brief Gets a view of all elements; invalidated by any growth.
      */
-    T* get_element(size_t index) {
-        if (index >= count) {
-            throw std::out_of_range("Index out of bounds");
-        }
-        return &elements[index];
+    ListView<T> view() {
+        return ListView<T>(elements, count);
     }
 
     /*!
-     * @brief Gets a const pointer to the element at the specified index.
-     *
-     * @param index The zero-based index of the element to retrieve.
-     * @return A const pointer to the element.
-     * @throw std::out_of_range if the index is out of bounds
+     * @brief Gets a read-only view of all elements.
      */
-    const T* get_element(size_t index) const {
-        if (index >= count) {
-            throw std::out_of_range("Index out of bounds");
-        }
-        return &elements[index];
+    ListView<const T> view() const {
+        return ListView<const T>(elements, count);
     }
 
     /*!
-     * @brief Sets the value of the element at the specified index.
+     * @brief Gets a view of elements [begin, end) without copying them.
      *
-     * @param index The zero-based index of the element to modify.
-     * @param value The new value to set.
-     * @throw std::out_of_range if the index is out of bounds
+     * @throw std::out_of_range if begin > end or end > length()
      */
-    void set_element(size_t index, const T& value) {
-        if (index >= count) {
-            throw std::out_of_range("Index out of bounds");
-        }
-        elements[index] = value;
+    ListView<T> slice(size_t begin, size_t end) {
+        return view().slice(begin, end);
     }
 
     /*!
-     * @brief Resets the list's element count to zero, effectively clearing it.
+     * @brief Gets a read-only view of elements [begin, end) without copying them.
      *
-     * The allocated memory buffer remains intact.
+     * @throw std::out_of_range if begin > end or end > length()
      */
-    void clear() {
-        count = 0;
+    ListView<const T> slice(size_t begin, size_t end) const {
+        return view().slice(begin, end);
     }
 
-    /*! @} */ // End of Access group
+    /*! @} */ // End of Iteration group
 
-    /*!
-     * @defgroup Manipulation Element Manipulation Functions
-     * @{
-     */
+private:
+    // Disable copy constructor and assignment operator to prevent shallow copying
+    List(const List&) = delete;
+    List& operator=(const List&) = delete;
 
+    // Enable move semantics
+public:
     /*!
-     * @brief Adds a new element to the end of the list.
+     * @brief Move constructor.
      *
-     * If capacity is reached, it attempts to double the capacity using realloc (if dynamically allocated).
+     * Moving out of a SmallList that still uses its inline buffer allocates a heap buffer for
+     * the elements; an allocation failure on that path terminates the program.
      *
-     * @param element The element to add.
-     * @throw std::runtime_error if list is invalid or memory reallocation fails
+     * @param other The List to move resources from.
      */
-    void add(const T& element) {
-        // Check for capacity and resize if needed
-        if (count >= capacity) {
-            size_t new_capacity = (capacity == 0) ? 1 : capacity * 2; // Doubling strategy
-            if (!resize(new_capacity)) {
-                throw std::runtime_error("Failed to reallocate memory for list expansion");
-            }
-        }
-
-        // Add new element
-        elements[count] = element;
-        count++;
+    List(List&& other) noexcept
+        : elements(nullptr),
+          count(0),
+          capacity(0),
+          is_dynamic(true),
+          is_inline(false),
+          allocator(other.allocator) {
+        take_contents(other);
     }
 
     /*!
-     * @brief Inserts a new element at the specified index, shifting subsequent elements right.
+     * @brief Move assignment operator.
      *
-     * If capacity is reached, it attempts to double the capacity using realloc (if dynamically allocated).
+     * The buffer is transferred when the allocator propagates or both allocators are equal.
+     * Otherwise this list cannot free other's buffer, so the elements are moved one by one
+     * into storage from this list's own allocator.
      *
-     * @param index The index where the new element should be inserted. Must be <= length().
-     * @param element The element to insert.
-     * @throw std::out_of_range if index is out of bounds
-     * @throw std::runtime_error if memory reallocation fails
+     * @param other The List to move resources from.
+     * @return A reference to this List.
      */
-    void insert(size_t index, const T& element) {
-        if (index > count) {
-            throw std::out_of_range("Index out of bounds");
-        }
+    List& operator=(List&& other) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_traits::is_always_equal::value) {
+        if (this != &other) {
+            // Clean up existing resources
+            release_storage();
+            is_dynamic = true;
 
-        // Check for capacity and resize if needed
-        if (count >= capacity) {
-            size_t new_capacity = (capacity == 0) ? 1 : capacity * 2;
-            if (!resize(new_capacity)) {
-                throw std::runtime_error("Failed to reallocate memory for list expansion");
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                allocator = other.allocator;
             }
-        }
 
-        // Shift elements to the right to make space
-        if (index < count) {
-            for (size_t i = count; i > index; --i) {
-                elements[i] = elements[i - 1];
-            }
+            // Transfer resources
+            take_contents(other);
         }
-
-        // Insert new element
-        elements[index] = element;
-        count++;
+        return *this;
     }
+};
 
-    /*!
-     * @brief Removes the element at the specified index, shifting subsequent elements left.
-     *
-     * Does not reduce the list's capacity.
-     *
-     * @param index The index of the element to remove. Must be < length().
-     * @throw std::out_of_range if index is out of bounds
-     */
-    void remove_at(size_t index) {
-        if (index >= count) {
-            throw std::out_of_range("Index out of bounds");
-        }
-
-        // Shift elements to the left to close gap
-        for (size_t i = index; i < count - 1; ++i) {
-            elements[i] = elements[i + 1];
-        }
+/*!
+ * @brief List that keeps its first N elements inside the object itself.
+ *
+ * Until more than N elements are stored there is no heap allocation at all; the list then
+ * spills to a heap buffer and grows like any other List. A SmallList is a List, so it can be
+ * passed to code taking List& and supports the whole List API.
+ *
+ * @tparam T The element type.
+ * @tparam N The number of elements stored inline. Must be > 0.
+ * @tparam Allocator Allocator used once the list spills to the heap.
+ * @tparam Growth Policy picking the new capacity when the list is full.
+ * @tparam Stats Statistics policy notified of allocations, shifts and searches.
+ */
+template <typename T, size_t N, typename Allocator = std::allocator<T>, typename Growth = GrowthDouble,
+          typename Stats = NoListStats>
+class SmallList : public List<T, Allocator, Growth, Stats> {
+    static_assert(N > 0, "SmallList needs room for at least one inline element");
 
-        count--;
-    }
+    using Base = List<T, Allocator, Growth, Stats>;
 
-    /*! @} */ // End of Manipulation group
+    alignas(T) unsigned char inline_storage[N * sizeof(T)]; ///< Raw storage for the inline elements
 
     /*!
-     * @defgroup Search Search Functions
-     * @{
+     * @brief Points the (empty, buffer-less) list back at its inline storage.
      */
+    void reset_to_inline() {
+        this->elements = reinterpret_cast<T*>(inline_storage);
+        this->capacity = N;
+        this->is_dynamic = false;
+        this->is_inline = true;
+        this->invalidate_iterators();
+    }
 
+public:
     /*!
-     * @brief Finds the index of the first occurrence of a matching value.
-     *
-     * Comparison is done using operator== for the type T.
+     * @brief Creates an empty list using its inline storage.
      *
-     * @param value The value to search for.
-     * @return The zero-based index of the found element, or -1 if not found.
+     * @param alloc The allocator used if the list spills to the heap.
      */
-    long index_of(const T& value) const {
-        for (size_t i = 0; i < count; ++i) {
-            if (elements[i] == value) {
-                return static_cast<long>(i);
-            }
-        }
-        return -1;
+    explicit SmallList(const Allocator& alloc = Allocator()) : Base(alloc) {
+        reset_to_inline();
     }
 
     /*!
-     * @brief Checks if the list contains a specific value.
-     *
-     * @param value The value to check for.
-     * @return true if the element is found, false otherwise.
+     * @brief Destructor that destroys the elements while the inline storage is still alive.
      */
-    bool contains(const T& value) const {
-        return index_of(value) >= 0;
+    ~SmallList() {
+        this->release_storage();
     }
 
-    /*! @} */ // End of Search group
-
     /*!
-     * @brief Overloaded array subscript operator for element access.
+     * @brief Move constructor. Inline elements are relocated, heap buffers are transferred.
      *
-     * @param index The zero-based index of the element to retrieve.
-     * @return A reference to the element at the specified index.
-     * @throw std::out_of_range if the index is out of bounds
+     * @param other The SmallList to move resources from.
      */
-    T& operator[](size_t index) {
-        if (index >= count) {
-            throw std::out_of_range("Index out of bounds");
+    SmallList(SmallList&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : Base(other.allocator) {
+        reset_to_inline();
+        this->take_contents(other);
+        if (other.elements == nullptr) {
+            other.reset_to_inline();
         }
-        return elements[index];
     }
 
     /*!
-     * @brief Overloaded const array subscript operator for element access.
+     * @brief Move assignment operator. Inline elements are relocated, heap buffers are transferred.
      *
-     * @param index The zero-based index of the element to retrieve.
-     * @return A const reference to the element at the specified index.
-     * @throw std::out_of_range if the index is out of bounds
+     * @param other The SmallList to move resources from.
+     * @return A reference to this SmallList.
      */
-    const T& operator[](size_t index) const {
-        if (index >= count) {
-            throw std::out_of_range("Index out of bounds");
+    SmallList& operator=(SmallList&& other) {
+        if (this != &other) {
+            this->release_storage();
+            reset_to_inline();
+            this->take_contents(other);
+            if (other.elements == nullptr) {
+                other.reset_to_inline();
+            }
         }
-        return elements[index];
+        return *this;
     }
 
-private:
-    // Disable copy constructor and assignment operator to prevent shallow copying
-    List(const List&) = delete;
-    List& operator=(const List&) = delete;
-
-    // Enable move semantics
-public:
     /*!
-     * @brief Move constructor.
+     * @brief Returns whether the elements currently live in the inline storage.
      *
-     * @param other The List to move resources from.
+     * @return true if the list has not spilled to the heap.
      */
-    List(List&& other) noexcept
-        : elements(other.elements),
-          count(other.count),
-          capacity(other.capacity),
-          is_dynamic(other.is_dynamic) {
-        // Reset the source object
-        other.elements = nullptr;
-        other.count = 0;
-        other.capacity = 0;
-        other.is_dynamic = true;
+    bool is_inline_storage() const {
+        return this->is_inline;
     }
 
     /*!
-     * @brief Move assignment operator.
+     * @brief Gets the number of elements that fit without a heap allocation.
      *
-     * @param other The List to move resources from.
-     * @return A reference to this List.
+     * @return The inline capacity N.
      */
-    List& operator=(List&& other) noexcept {
-        if (this != &other) {
-            // Clean up existing resources
-            if (is_dynamic && elements != nullptr) {
-                delete[] elements;
-            }
-
-            // Transfer resources
-            elements = other.elements;
-            count = other.count;
-            capacity = other.capacity;
-            is_dynamic = other.is_dynamic;
+    static constexpr size_t inline_capacity() {
+        return N;
+    }
 
-            // Reset the source object
-            other.elements = nullptr;
-            other.count = 0;
-            other.capacity = 0;
-            other.is_dynamic = true;
+    /*!
+     * @brief Reduces the capacity to the number of stored elements.
+     *
+     * A spilled list whose elements fit inline again moves back into the inline storage
+     * and frees its heap buffer.
+     */
+    void shrink_to_fit() {
+        if (this->is_dynamic && this->count <= N) {
+            T* heap_elements = this->elements;
+            size_t heap_capacity = this->capacity;
+            list_detail::relocate(this->allocator, reinterpret_cast<T*>(inline_storage),
+                                  heap_elements, this->count);
+            reset_to_inline();
+            this->deallocate_storage(heap_elements, heap_capacity);
+            return;
         }
-        return *this;
+        Base::shrink_to_fit();
     }
 };
 
@@ -435,12 +2098,15 @@ public:
  * This function requires that the element type T has operator<< defined for std::ostream.
  *
  * @tparam T The type of elements stored in the list.
+ * @tparam Allocator The list's allocator type.
+ * @tparam Growth The list's growth policy.
+ * @tparam Stats The list's statistics policy.
  * @param os The output stream to write to.
  * @param list The list to print.
  * @return The output stream.
  */
-template <typename T>
-std::ostream& operator<<(std::ostream& os, const List<T>& list) {
+template <typename T, typename Allocator, typename Growth, typename Stats>
+std::ostream& operator<<(std::ostream& os, const List<T, Allocator, Growth, Stats>& list) {
     if (list.is_empty()) {
         os << "List is empty (count: 0)";
         return os;
@@ -448,7 +2114,7 @@ std::ostream& operator<<(std::ostream& os, const List<T>& list) {
 
     os << "List (count: " << list.length() << ", capacity: " << list.get_capacity() << "): [";
     for (size_t i = 0; i < list.length(); ++i) {
-        os << list.get_element(i);
+        os << list[i];
         if (i < list.length() - 1) {
             os << ", ";
         }
@@ -457,4 +2123,26 @@ std::ostream& operator<<(std::ostream& os, const List<T>& list) {
     return os;
 }
 
+#if __has_include(<memory_resource>)
+namespace pmr {
+
+/*!
+ * @brief List whose storage comes from a std::pmr::memory_resource.
+ *
+ * Pass the resource (e.g. a std::pmr::monotonic_buffer_resource arena) to the constructor;
+ * every buffer the list allocates is then drawn from it and released when the arena is.
+ *
+ * @tparam T The element type.
+ * @tparam Growth Policy picking the new capacity when the list is full.
+ * @tparam Stats Statistics policy notified of allocations, shifts and searches.
+ */
+template <typename T, typename Growth = GrowthDouble, typename Stats = NoListStats>
+using List = ::List<T, std::pmr::polymorphic_allocator<T>, Growth, Stats>;
+
+} // namespace pmr
+#endif
+
+// The bit-packed List<bool> must be visible wherever List is
+#include "list_bool.hpp"
+
 #endif // LIST_HPP
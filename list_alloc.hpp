@@ -0,0 +1,258 @@
+/*!
+ * @file list_alloc.hpp
+ * @brief Allocators for over-aligned and hugepage-backed list storage
+ *
+ * Both are standard allocators, so they plug into the Allocator parameter of List (and of
+ * every container built on it):
+ *
+ *     List<float, AlignedAllocator<float, 64>> scan_target;
+ *     List<float, HugePageAllocator<float>, GrowthPageRounded<GrowthDouble, 2 << 20>> big;
+ */
+
+#ifndef LIST_ALLOC_HPP
+#define LIST_ALLOC_HPP
+
+#include "list.hpp"
+
+#include <cstdint>
+#include <new>
+
+#ifndef LIST_HAS_MMAP
+#if (defined(__unix__) || defined(__APPLE__)) && __has_include(<sys/mman.h>)
+#define LIST_HAS_MMAP 1
+#else
+#define LIST_HAS_MMAP 0
+#endif
+#endif
+
+#if LIST_HAS_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(__linux__) && __has_include(<sys/syscall.h>)
+#include <sys/syscall.h>
+#endif
+#endif
+
+/*!
+ * @brief Allocator whose buffers start on an Alignment-byte boundary.
+ *
+ * With the default of 64 a buffer never starts part-way into a cache line, so full scans do
+ * not pay for a split line at the front and vector loads of the first elements are aligned.
+ * Larger values such as 4096 align buffers to pages.
+ *
+ * @tparam T The element type.
+ * @tparam Alignment The alignment in bytes. Must be a power of two, at least alignof(T).
+ */
+template <typename T, size_t Alignment = 64>
+class AlignedAllocator {
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment must be at least alignof(T)");
+
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    /*!
+     * @brief Allocates uninitialized storage for n elements.
+     *
+     * @throw std::bad_alloc if the storage cannot be obtained
+     */
+    T* allocate(size_t n) {
+        if (n > static_cast<size_t>(-1) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* buffer, size_t /*n*/) noexcept {
+        ::operator delete(buffer, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return false;
+    }
+};
+
+/*!
+ * @brief Placement policy of a HugePageAllocator.
+ */
+struct HugePageOptions {
+    size_t threshold = size_t(2) << 20; ///< Allocations smaller than this use aligned operator new
+    bool explicit_hugetlb = false;      ///< Try MAP_HUGETLB (reserved hugepages) before transparent ones
+    int numa_node = -1;                 ///< Preferred NUMA node for the pages, or -1 for the default
+
+    bool operator==(const HugePageOptions& other) const {
+        return threshold == other.threshold && explicit_hugetlb == other.explicit_hugetlb &&
+               numa_node == other.numa_node;
+    }
+};
+
+namespace list_detail {
+
+constexpr size_t huge_page_size = size_t(2) << 20;
+
+inline size_t round_to_huge_page(size_t bytes) {
+    return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+}
+
+#if LIST_HAS_MMAP
+/*!
+ * @brief Maps bytes (a multiple of huge_page_size) of anonymous memory starting on a
+ * huge_page_size boundary, applying the hugepage and NUMA hints in options.
+ *
+ * @return The mapping, or nullptr if it could not be created.
+ */
+inline void* map_huge_pages(size_t bytes, const HugePageOptions& options) {
+    void* block = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+    if (options.explicit_hugetlb) {
+        block = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+    if (block == MAP_FAILED) {
+        // Over-map by one huge page and trim, so the block is aligned for transparent hugepages
+        size_t padded = bytes + huge_page_size;
+        void* raw = ::mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            return nullptr;
+        }
+        uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+        uintptr_t aligned = (start + huge_page_size - 1) & ~(uintptr_t(huge_page_size) - 1);
+        if (aligned > start) {
+            ::munmap(raw, aligned - start);
+        }
+        size_t tail = (start + padded) - (aligned + bytes);
+        if (tail > 0) {
+            ::munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+        }
+        block = reinterpret_cast<void*>(aligned);
+#if defined(MADV_HUGEPAGE)
+        ::madvise(block, bytes, MADV_HUGEPAGE);
+#endif
+    }
+#if defined(__linux__) && defined(SYS_mbind)
+    if (options.numa_node >= 0 && options.numa_node < 64) {
+        // MPOL_PREFERRED: a placement hint, so a failure here is not an error
+        constexpr int mpol_preferred = 1;
+        unsigned long node_mask = 1ul << options.numa_node;
+        ::syscall(SYS_mbind, block, bytes, mpol_preferred, &node_mask, 64ul, 0u);
+    }
+#endif
+    return block;
+}
+#endif
+
+} // namespace list_detail
+
+/*!
+ * @brief Allocator that backs large buffers with 2 MiB pages.
+ *
+ * Buffers of at least options.threshold bytes are mapped directly (rounded up to whole huge
+ * pages and aligned to 2 MiB), advised with MADV_HUGEPAGE and optionally placed on a NUMA node,
+ * which cuts the TLB misses of full scans over multi-gigabyte lists. Smaller buffers come from
+ * 64-byte aligned operator new. Pair it with GrowthPageRounded<..., 2 << 20> so that growth
+ * uses the whole rounded mapping.
+ *
+ * Where mmap is unavailable every buffer comes from aligned operator new.
+ *
+ * @tparam T The element type. alignof(T) must not exceed 64.
+ */
+template <typename T>
+class HugePageAllocator {
+    static_assert(alignof(T) <= 64, "HugePageAllocator supports alignments up to 64 bytes");
+
+    template <typename U>
+    friend class HugePageAllocator;
+
+    HugePageOptions options; ///< Shared by every buffer from this allocator
+
+    static constexpr size_t small_alignment = 64;
+
+    bool is_mapped(size_t bytes) const {
+        return LIST_HAS_MMAP && bytes >= options.threshold;
+    }
+
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = HugePageAllocator<U>;
+    };
+
+    explicit HugePageAllocator(const HugePageOptions& options = HugePageOptions()) noexcept : options(options) {}
+
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U>& other) noexcept : options(other.options) {}
+
+    /*!
+     * @brief Gets the placement policy.
+     */
+    const HugePageOptions& get_options() const noexcept {
+        return options;
+    }
+
+    /*!
+     * @brief Allocates uninitialized storage for n elements.
+     *
+     * @throw std::bad_alloc if the storage cannot be obtained
+     */
+    T* allocate(size_t n) {
+        // Leaves room in bytes for rounding up to a whole huge page
+        if (n > (static_cast<size_t>(-1) - list_detail::huge_page_size) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        size_t bytes = n * sizeof(T);
+#if LIST_HAS_MMAP
+        if (is_mapped(bytes)) {
+            void* block = list_detail::map_huge_pages(list_detail::round_to_huge_page(bytes), options);
+            if (block == nullptr) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(block);
+        }
+#endif
+        return static_cast<T*>(::operator new(bytes, std::align_val_t(small_alignment)));
+    }
+
+    /*!
+     * @brief Releases storage from allocate; n must be the count it was allocated for.
+     */
+    void deallocate(T* buffer, size_t n) noexcept {
+        size_t bytes = n * sizeof(T);
+#if LIST_HAS_MMAP
+        if (is_mapped(bytes)) {
+            ::munmap(static_cast<void*>(buffer), list_detail::round_to_huge_page(bytes));
+            return;
+        }
+#endif
+        ::operator delete(static_cast<void*>(buffer), std::align_val_t(small_alignment));
+    }
+
+    template <typename U>
+    bool operator==(const HugePageAllocator<U>& other) const noexcept {
+        return options == other.options;
+    }
+
+    template <typename U>
+    bool operator!=(const HugePageAllocator<U>& other) const noexcept {
+        return !(*this == other);
+    }
+};
+
+#endif // LIST_ALLOC_HPP
@@ -0,0 +1,281 @@
+/*!
+ * @file list_batch.hpp
+ * @brief Batched multi-key search used by List::index_of_many and List::contains_many
+ *
+ * Looking up k keys one at a time rescans the list k times. These kernels answer the whole
+ * batch together, with one of three strategies:
+ *
+ * - blocked: walks the list in cache-sized blocks and tests every unresolved key against each
+ *   block while it is in L1, with the SIMD kernel. O(n * k) compares but one pass over memory;
+ *   best for small batches.
+ * - hashed: puts the keys in a temporary open-addressing table and scans the list once,
+ *   probing it per element. O(n + k); needs std::hash<T>.
+ * - sorted: sorts the keys once and scans the list once, binary-searching them per element.
+ *   O((n + k) log k); needs operator<.
+ *
+ * Every strategy stops scanning as soon as every distinct key has been found.
+ */
+
+#ifndef LIST_BATCH_HPP
+#define LIST_BATCH_HPP
+
+#include "list_simd.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace list_batch {
+
+/*!
+ * @brief Strategy for a batched lookup (see list_batch.hpp).
+ */
+enum class Strategy {
+    automatic, ///< Choose from the batch size, the list size and what T supports
+    blocked,   ///< Cache-blocked SIMD scans
+    hashed,    ///< Temporary hash set of the keys
+    sorted     ///< Sorted keys, binary-searched per element
+};
+
+namespace detail {
+
+template <typename T, typename = void>
+struct is_hashable : std::false_type {};
+
+template <typename T>
+struct is_hashable<T, std::void_t<decltype(std::hash<T>()(std::declval<const T&>()))>>
+    : std::is_default_constructible<std::hash<T>> {};
+
+template <typename T, typename = void>
+struct is_ordered : std::false_type {};
+
+template <typename T>
+struct is_ordered<T, std::void_t<decltype(std::declval<const T&>() < std::declval<const T&>())>> : std::true_type {};
+
+constexpr size_t none = static_cast<size_t>(-1);
+
+/*!
+ * @brief Result sink writing the first position of each key (-1 when absent).
+ */
+struct IndexOutput {
+    long* out;
+
+    void reset(size_t key) const {
+        out[key] = -1;
+    }
+    bool has(size_t key) const {
+        return out[key] >= 0;
+    }
+    void set(size_t key, size_t position) const {
+        out[key] = static_cast<long>(position);
+    }
+    void copy(size_t key, size_t from) const {
+        out[key] = out[from];
+    }
+};
+
+/*!
+ * @brief Result sink writing whether each key occurs.
+ */
+struct ContainsOutput {
+    bool* out;
+
+    void reset(size_t key) const {
+        out[key] = false;
+    }
+    bool has(size_t key) const {
+        return out[key];
+    }
+    void set(size_t key, size_t /*position*/) const {
+        out[key] = true;
+    }
+    void copy(size_t key, size_t from) const {
+        out[key] = out[from];
+    }
+};
+
+template <typename T, typename Output>
+void blocked(const T* data, size_t n, const T* keys, size_t k, const Output& output) {
+    constexpr size_t block_bytes = 16 * 1024; // Comfortably inside L1
+    constexpr size_t block = block_bytes / sizeof(T) > 0 ? block_bytes / sizeof(T) : 1;
+
+    size_t resolved = 0;
+    for (size_t base = 0; base < n && resolved < k; base += block) {
+        size_t len = n - base < block ? n - base : block;
+        for (size_t key = 0; key < k; ++key) {
+            if (!output.has(key)) {
+                long found = list_simd::find_first(data + base, len, keys[key]);
+                if (found >= 0) {
+                    output.set(key, base + static_cast<size_t>(found));
+                    resolved++;
+                }
+            }
+        }
+    }
+}
+
+template <typename T, typename Output>
+void hashed(const T* data, size_t n, const T* keys, size_t k, const Output& output) {
+    std::hash<T> hasher;
+    unsigned bits = 4;
+    while ((size_t(1) << bits) < 2 * k) {
+        bits++;
+    }
+    size_t mask = (size_t(1) << bits) - 1;
+    auto slot_of = [&](const T& value) {
+        return static_cast<size_t>((static_cast<uint64_t>(hasher(value)) * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+    };
+
+    std::unique_ptr<size_t[]> table(new size_t[mask + 1]);
+    std::fill(table.get(), table.get() + mask + 1, none);
+    std::unique_ptr<size_t[]> alias(new size_t[k]); // Earlier equal key, or none
+    size_t distinct = 0;
+    for (size_t key = 0; key < k; ++key) {
+        alias[key] = none;
+        size_t i = slot_of(keys[key]);
+        while (table[i] != none && !(keys[table[i]] == keys[key])) {
+            i = (i + 1) & mask;
+        }
+        if (table[i] == none) {
+            table[i] = key;
+            distinct++;
+        } else {
+            alias[key] = table[i];
+        }
+    }
+
+    size_t resolved = 0;
+    for (size_t position = 0; position < n && resolved < distinct; ++position) {
+        for (size_t i = slot_of(data[position]); table[i] != none; i = (i + 1) & mask) {
+            size_t key = table[i];
+            if (keys[key] == data[position]) {
+                if (!output.has(key)) {
+                    output.set(key, position);
+                    resolved++;
+                }
+                break;
+            }
+        }
+    }
+
+    for (size_t key = 0; key < k; ++key) {
+        if (alias[key] != none) {
+            output.copy(key, alias[key]);
+        }
+    }
+}
+
+template <typename T, typename Output>
+void sorted(const T* data, size_t n, const T* keys, size_t k, const Output& output) {
+    std::unique_ptr<size_t[]> order(new size_t[k]);
+    for (size_t key = 0; key < k; ++key) {
+        order[key] = key;
+    }
+    std::stable_sort(order.get(), order.get() + k, [&](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+    // Keep the first key of every run of equal keys; the others copy its result at the end
+    std::unique_ptr<size_t[]> alias(new size_t[k]);
+    size_t distinct = 0;
+    for (size_t i = 0; i < k; ++i) {
+        size_t key = order[i];
+        if (distinct > 0 && !(keys[order[distinct - 1]] < keys[key])) {
+            alias[key] = order[distinct - 1];
+        } else {
+            alias[key] = none;
+            order[distinct++] = key;
+        }
+    }
+
+    size_t resolved = 0;
+    for (size_t position = 0; position < n && resolved < distinct; ++position) {
+        const T& value = data[position];
+        size_t* first = std::lower_bound(order.get(), order.get() + distinct, value,
+                                         [&](size_t key, const T& v) { return keys[key] < v; });
+        if (first != order.get() + distinct && !(value < keys[*first]) && !output.has(*first)) {
+            output.set(*first, position);
+            resolved++;
+        }
+    }
+
+    for (size_t key = 0; key < k; ++key) {
+        if (alias[key] != none) {
+            output.copy(key, alias[key]);
+        }
+    }
+}
+
+template <typename T, typename Output>
+void run(const T* data, size_t n, const T* keys, size_t k, const Output& output, Strategy strategy) {
+    for (size_t key = 0; key < k; ++key) {
+        output.reset(key);
+    }
+    if (k == 0 || n == 0) {
+        return;
+    }
+    if (strategy == Strategy::automatic) {
+        if (k <= 16 || n <= 256) {
+            strategy = Strategy::blocked;
+        } else if (is_hashable<T>::value) {
+            strategy = Strategy::hashed;
+        } else if (is_ordered<T>::value) {
+            strategy = Strategy::sorted;
+        } else {
+            strategy = Strategy::blocked;
+        }
+    }
+    if constexpr (is_hashable<T>::value) {
+        if (strategy == Strategy::hashed) {
+            hashed(data, n, keys, k, output);
+            return;
+        }
+    }
+    if constexpr (is_ordered<T>::value) {
+        if (strategy == Strategy::sorted) {
+            sorted(data, n, keys, k, output);
+            return;
+        }
+    }
+    blocked(data, n, keys, k, output); // Also the fallback when T lacks what was asked for
+}
+
+} // namespace detail
+
+/*!
+ * @brief Writes to out[i] the index of the first element equal to keys[i], or -1.
+ *
+ * @param data The elements to search.
+ * @param n Number of elements.
+ * @param keys The keys to look up.
+ * @param k Number of keys.
+ * @param out Receives k indices.
+ * @param strategy How to search (see list_batch.hpp).
+ */
+template <typename T>
+void index_of_many(const T* data, size_t n, const T* keys, size_t k, long* out,
+                   Strategy strategy = Strategy::automatic) {
+    detail::run(data, n, keys, k, detail::IndexOutput{out}, strategy);
+}
+
+/*!
+ * @brief Writes to out[i] whether some element equals keys[i].
+ *
+ * @param data The elements to search.
+ * @param n Number of elements.
+ * @param keys The keys to look up.
+ * @param k Number of keys.
+ * @param out Receives k flags.
+ * @param strategy How to search (see list_batch.hpp).
+ */
+template <typename T>
+void contains_many(const T* data, size_t n, const T* keys, size_t k, bool* out,
+                   Strategy strategy = Strategy::automatic) {
+    detail::run(data, n, keys, k, detail::ContainsOutput{out}, strategy);
+}
+
+} // namespace list_batch
+
+#endif // LIST_BATCH_HPP
@@ -0,0 +1,758 @@
+/*!
+ * @file list_bool.hpp
+ * @brief Bit-packed specialization of List for bool
+ *
+ * Included by list.hpp, so every translation unit sees the same List<bool>.
+ */
+
+#ifndef LIST_BOOL_HPP
+#define LIST_BOOL_HPP
+
+#include "list.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace list_detail {
+
+/*!
+ * @brief Index of the lowest set bit of a non-zero word.
+ */
+inline unsigned lowest_bit(uint64_t word) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    unsigned bit = 0;
+    while ((word & 1) == 0) {
+        word >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+/*!
+ * @brief Number of set bits in a word.
+ */
+inline size_t popcount(uint64_t word) {
+#if defined(__GNUC__)
+    return static_cast<size_t>(__builtin_popcountll(word));
+#else
+    size_t bits = 0;
+    for (; word != 0; word &= word - 1) {
+        bits++;
+    }
+    return bits;
+#endif
+}
+
+} // namespace list_detail
+
+/*!
+ * @brief List of flags packed 64 to a word.
+ *
+ * Stores one bit per element instead of one byte, and runs searches and counts a word at a
+ * time with count-trailing-zeros and popcount. Because single bits are not addressable,
+ * operator[] and at return a proxy reference, and there is no data(), get_element or view();
+ * word_data() exposes the packed words instead. Bits past length() are always zero.
+ *
+ * Bulk and_with / or_with / xor_with (and &=, |=, ^=) combine two lists of the same length
+ * word by word.
+ *
+ * SmallList<bool, N> is not supported, since its inline storage holds unpacked elements.
+ *
+ * @tparam Allocator Allocator for bool; it is rebound to allocate the 64-bit words.
+ * @tparam Growth Policy picking the new capacity, in words, when the list is full.
+ * @tparam Stats Statistics policy notified of allocations and reallocations.
+ */
+template <typename Allocator, typename Growth, typename Stats>
+class List<bool, Allocator, Growth, Stats> {
+public:
+    using value_type = bool;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using word_type = uint64_t;
+
+    static constexpr size_t word_bits = 64;
+
+private:
+    using word_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<word_type>;
+    using word_traits = std::allocator_traits<word_allocator>;
+
+    word_type* words;         ///< The packed flags; bit i of the list is bit i % 64 of words[i / 64]
+    size_t count;             ///< The current number of flags stored
+    size_t word_capacity;     ///< The number of words allocated
+    word_allocator allocator; ///< Source of the word buffer
+    mutable Stats statistics; ///< Operation counters (empty unless a recording policy is chosen)
+
+    static size_t words_for(size_t bits) {
+        return (bits + word_bits - 1) / word_bits;
+    }
+
+    /*!
+     * @brief Mask of the bits of the last word that hold flags (all ones for a full word).
+     */
+    word_type tail_mask() const {
+        size_t used = count % word_bits;
+        return used == 0 ? ~word_type(0) : (word_type(1) << used) - 1;
+    }
+
+    /*!
+     * @brief Moves the flags into a zeroed buffer of new_words words.
+     *
+     * @throw std::runtime_error if memory allocation fails
+     */
+    void resize_words(size_t new_words) {
+        word_type* fresh = nullptr;
+        try {
+            fresh = word_traits::allocate(allocator, new_words);
+        } catch (const std::bad_alloc&) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+        statistics.on_allocate(new_words * word_bits, new_words * sizeof(word_type));
+        size_t used = words_for(count);
+        if (used > 0) {
+            std::memcpy(fresh, words, used * sizeof(word_type));
+        }
+        std::memset(fresh + used, 0, (new_words - used) * sizeof(word_type));
+        if (word_capacity > 0) {
+            statistics.on_reallocate(count);
+        }
+        release_words();
+        words = fresh;
+        word_capacity = new_words;
+    }
+
+    void release_words() {
+        if (words != nullptr) {
+            word_traits::deallocate(allocator, words, word_capacity);
+            statistics.on_deallocate(word_capacity * sizeof(word_type));
+        }
+        words = nullptr;
+        word_capacity = 0;
+    }
+
+    /*!
+     * @brief Makes room for one more flag, growing by the growth policy if needed.
+     */
+    void reserve_one() {
+        if (count == word_capacity * word_bits) {
+            resize_words(Growth::grow(word_capacity, words_for(count + 1), sizeof(word_type)));
+        }
+    }
+
+    void check_index(size_t index) const {
+        list_detail::check_index(index < count);
+    }
+
+    bool test(size_t index) const {
+        return (words[index / word_bits] >> (index % word_bits)) & 1;
+    }
+
+    void assign(size_t index, bool value) {
+        word_type mask = word_type(1) << (index % word_bits);
+        word_type& word = words[index / word_bits];
+        word = value ? (word | mask) : (word & ~mask);
+    }
+
+    /*!
+     * @brief Finds the first index >= from whose flag equals value.
+     */
+    long find_next(size_t from, bool value) const {
+        if (from >= count) {
+            return -1;
+        }
+        size_t last = words_for(count) - 1;
+        size_t w = from / word_bits;
+        word_type invert = value ? 0 : ~word_type(0);
+        word_type word = (words[w] ^ invert) & (~word_type(0) << (from % word_bits));
+        while (true) {
+            if (w == last) {
+                word &= tail_mask();
+            }
+            if (word != 0) {
+                return static_cast<long>(w * word_bits + list_detail::lowest_bit(word));
+            }
+            if (w == last) {
+                return -1;
+            }
+            word = words[++w] ^ invert;
+        }
+    }
+
+    void check_same_length(const List& other) const {
+        if (other.count != count) {
+            throw std::invalid_argument("Lists must have the same length");
+        }
+    }
+
+    void take_contents(List& other) {
+        if (other.words != nullptr) {
+            statistics.on_adopt(other.statistics, other.word_capacity * sizeof(word_type));
+        }
+        words = other.words;
+        count = other.count;
+        word_capacity = other.word_capacity;
+        other.words = nullptr;
+        other.count = 0;
+        other.word_capacity = 0;
+    }
+
+public:
+    /*!
+     * @brief Proxy for one flag, returned by the non-const operator[] and at.
+     */
+    class reference {
+        word_type* word; ///< The word holding the flag
+        word_type mask;  ///< The flag's bit within it
+
+        friend class List;
+
+        reference(word_type* word, size_t bit) : word(word), mask(word_type(1) << bit) {}
+
+    public:
+        reference(const reference&) = default;
+
+        operator bool() const {
+            return (*word & mask) != 0;
+        }
+
+        reference& operator=(bool value) {
+            *word = value ? (*word | mask) : (*word & ~mask);
+            return *this;
+        }
+
+        reference& operator=(const reference& other) {
+            return *this = static_cast<bool>(other);
+        }
+
+        void flip() {
+            *word ^= mask;
+        }
+
+        friend void swap(reference a, reference b) {
+            bool value = a;
+            a = static_cast<bool>(b);
+            b = value;
+        }
+        friend void swap(reference a, bool& b) {
+            bool value = a;
+            a = b;
+            b = value;
+        }
+        friend void swap(bool& a, reference b) {
+            swap(b, a);
+        }
+    };
+
+    using const_reference = bool;
+
+    /*!
+     * @brief Random-access iterator over the flags; Const selects bool or reference results.
+     */
+    template <bool Const>
+    class basic_iterator {
+        using list_type = std::conditional_t<Const, const List, List>;
+
+        list_type* list = nullptr; ///< The list iterated over
+        size_t index = 0;          ///< Current position
+
+        friend class List;
+        template <bool>
+        friend class basic_iterator;
+
+        basic_iterator(list_type* list, size_t index) : list(list), index(index) {}
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::conditional_t<Const, bool, typename List::reference>;
+
+        basic_iterator() = default;
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& other) : list(other.list), index(other.index) {}
+
+        reference operator*() const {
+            return (*list)[index];
+        }
+        reference operator[](difference_type n) const {
+            return (*list)[index + n];
+        }
+
+        basic_iterator& operator++() {
+            ++index;
+            return *this;
+        }
+        basic_iterator operator++(int) {
+            basic_iterator old = *this;
+            ++index;
+            return old;
+        }
+        basic_iterator& operator--() {
+            --index;
+            return *this;
+        }
+        basic_iterator operator--(int) {
+            basic_iterator old = *this;
+            --index;
+            return old;
+        }
+        basic_iterator& operator+=(difference_type n) {
+            index += n;
+            return *this;
+        }
+        basic_iterator& operator-=(difference_type n) {
+            index -= n;
+            return *this;
+        }
+        friend basic_iterator operator+(basic_iterator it, difference_type n) {
+            return it += n;
+        }
+        friend basic_iterator operator+(difference_type n, basic_iterator it) {
+            return it += n;
+        }
+        friend basic_iterator operator-(basic_iterator it, difference_type n) {
+            return it -= n;
+        }
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.index == b.index;
+        }
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return a.index != b.index;
+        }
+        friend bool operator<(const basic_iterator& a, const basic_iterator& b) {
+            return a.index < b.index;
+        }
+        friend bool operator>(const basic_iterator& a, const basic_iterator& b) {
+            return a.index > b.index;
+        }
+        friend bool operator<=(const basic_iterator& a, const basic_iterator& b) {
+            return a.index <= b.index;
+        }
+        friend bool operator>=(const basic_iterator& a, const basic_iterator& b) {
+            return a.index >= b.index;
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /*!
+     * @defgroup BoolInitialization Initialization and Destruction Functions
+     * @{
+     */
+
+    /*!
+     * @brief Creates an empty list; no memory is allocated until the first add.
+     */
+    List() : words(nullptr), count(0), word_capacity(0), allocator() {}
+
+    explicit List(const Allocator& alloc) : words(nullptr), count(0), word_capacity(0), allocator(alloc) {}
+
+    /*!
+     * @brief Creates an empty list with room for capacity flags.
+     *
+     * @throw std::invalid_argument if capacity is 0
+     * @throw std::runtime_error if memory allocation fails
+     */
+    explicit List(size_t capacity, const Allocator& alloc = Allocator())
+        : words(nullptr), count(0), word_capacity(0), allocator(alloc) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Capacity must be greater than 0");
+        }
+        resize_words(words_for(capacity));
+    }
+
+    List(const List&) = delete;
+    List& operator=(const List&) = delete;
+
+    List(List&& other) noexcept
+        : words(nullptr), count(0), word_capacity(0), allocator(std::move(other.allocator)) {
+        take_contents(other);
+    }
+
+    /*!
+     * @brief Move assignment. The buffer is transferred when the allocator propagates or both
+     * allocators are equal; otherwise the words are copied into this list's allocator.
+     */
+    List& operator=(List&& other) {
+        if (this == &other) {
+            return *this;
+        }
+        release_words();
+        count = 0;
+        if constexpr (word_traits::propagate_on_container_move_assignment::value) {
+            allocator = std::move(other.allocator);
+            take_contents(other);
+        } else {
+            if (allocator == other.allocator) {
+                take_contents(other);
+            } else {
+                if (other.count > 0) {
+                    resize_words(words_for(other.count));
+                    std::memcpy(words, other.words, words_for(other.count) * sizeof(word_type));
+                }
+                count = other.count;
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    ~List() {
+        release_words();
+    }
+
+    /*! @} */ // End of BoolInitialization group
+
+    /*!
+     * @defgroup BoolInformation Basic Information
+     * @{
+     */
+
+    size_t length() const {
+        return count;
+    }
+
+    /*!
+     * @brief Gets the number of flags the allocated words can hold.
+     */
+    size_t get_capacity() const {
+        return word_capacity * word_bits;
+    }
+
+    bool is_empty() const {
+        return count == 0;
+    }
+
+    bool is_dynamic_allocation() const {
+        return true;
+    }
+
+    Allocator get_allocator() const {
+        return Allocator(allocator);
+    }
+
+    Stats& stats() const {
+        return statistics;
+    }
+
+    /*!
+     * @brief Gets the packed words (bit i of the list is bit i % 64 of word i / 64).
+     */
+    const word_type* word_data() const {
+        return words;
+    }
+
+    /*!
+     * @brief Gets the number of words holding flags.
+     */
+    size_t word_count() const {
+        return words_for(count);
+    }
+
+    /*!
+     * @brief Makes room for at least new_capacity flags.
+     *
+     * @throw std::runtime_error if memory allocation fails
+     */
+    void reserve(size_t new_capacity) {
+        if (new_capacity > get_capacity()) {
+            resize_words(words_for(new_capacity));
+        }
+    }
+
+    /*!
+     * @brief Reduces the allocation to the words in use.
+     */
+    void shrink_to_fit() {
+        size_t used = words_for(count);
+        if (used == word_capacity) {
+            return;
+        }
+        if (used == 0) {
+            release_words();
+            return;
+        }
+        resize_words(used);
+    }
+
+    /*! @} */ // End of BoolInformation group
+
+    /*!
+     * @defgroup BoolAccess Access
+     * @{
+     */
+
+    reference operator[](size_t index) {
+        list_detail::debug_check_index(index < count);
+        return reference(words + index / word_bits, index % word_bits);
+    }
+
+    bool operator[](size_t index) const {
+        list_detail::debug_check_index(index < count);
+        return test(index);
+    }
+
+    /*!
+     * @brief Gets the flag at the specified index, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    reference at(size_t index) {
+        check_index(index);
+        return (*this)[index];
+    }
+
+    bool at(size_t index) const {
+        check_index(index);
+        return test(index);
+    }
+
+    /*!
+     * @brief Sets the flag at the specified index.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    void set_element(size_t index, bool value) {
+        check_index(index);
+        assign(index, value);
+    }
+
+    iterator begin() {
+        return iterator(this, 0);
+    }
+
+    iterator end() {
+        return iterator(this, count);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, count);
+    }
+
+    /*!
+     * @brief Clears every flag and sets the length to zero; the words remain allocated.
+     */
+    void clear() {
+        if (count > 0) {
+            std::memset(words, 0, words_for(count) * sizeof(word_type));
+        }
+        count = 0;
+    }
+
+    /*! @} */ // End of BoolAccess group
+
+    /*!
+     * @defgroup BoolManipulation Element Manipulation Functions
+     * @{
+     */
+
+    /*!
+     * @brief Adds a flag at the end of the list.
+     *
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void add(bool value) {
+        reserve_one();
+        // The slot is already zero, so only a set flag needs writing
+        words[count / word_bits] |= word_type(value) << (count % word_bits);
+        count++;
+    }
+
+    /*!
+     * @brief Inserts a flag at index, shifting the following flags up by one bit.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void insert(size_t index, bool value) {
+        list_detail::check_index(index <= count);
+        reserve_one();
+        size_t first = index / word_bits;
+        size_t last = count / word_bits;
+        for (size_t w = last; w > first; --w) {
+            words[w] = (words[w] << 1) | (words[w - 1] >> (word_bits - 1));
+        }
+        word_type low = (word_type(1) << (index % word_bits)) - 1;
+        word_type word = words[first];
+        words[first] = (word & low) | ((word & ~low) << 1) | (word_type(value) << (index % word_bits));
+        count++;
+    }
+
+    /*!
+     * @brief Removes the flag at index, shifting the following flags down by one bit.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     */
+    void remove_at(size_t index) {
+        check_index(index);
+        size_t first = index / word_bits;
+        size_t last = (count - 1) / word_bits;
+        word_type low = (word_type(1) << (index % word_bits)) - 1;
+        word_type word = words[first];
+        words[first] = (word & low) | ((word >> 1) & ~low);
+        for (size_t w = first; w < last; ++w) {
+            words[w] |= words[w + 1] << (word_bits - 1);
+            words[w + 1] >>= 1;
+        }
+        count--;
+    }
+
+    /*!
+     * @brief Removes the flag at index in O(1) by moving the last flag into its place.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     */
+    void swap_remove(size_t index) {
+        check_index(index);
+        assign(index, test(count - 1));
+        assign(count - 1, false);
+        count--;
+    }
+
+    /*! @} */ // End of BoolManipulation group
+
+    /*!
+     * @defgroup BoolSearch Search and Counting
+     * @{
+     */
+
+    /*!
+     * @brief Finds the first index >= from whose flag is set, a word at a time.
+     *
+     * @return The index, or -1 if no later flag is set.
+     */
+    long find_next_set(size_t from) const {
+        return find_next(from, true);
+    }
+
+    /*!
+     * @brief Finds the first index >= from whose flag is clear.
+     *
+     * @return The index, or -1 if every later flag is set.
+     */
+    long find_next_clear(size_t from) const {
+        return find_next(from, false);
+    }
+
+    /*!
+     * @brief Finds the index of the first flag equal to value.
+     *
+     * @return The zero-based index, or -1 if not found.
+     */
+    long index_of(bool value) const {
+        return find_next(0, value);
+    }
+
+    bool contains(bool value) const {
+        return index_of(value) >= 0;
+    }
+
+    /*!
+     * @brief Counts the set flags with one popcount per word.
+     */
+    size_t count_true() const {
+        size_t total = 0;
+        for (size_t w = 0, n = words_for(count); w < n; ++w) {
+            total += list_detail::popcount(words[w]);
+        }
+        return total;
+    }
+
+    size_t count_of(bool value) const {
+        return value ? count_true() : count - count_true();
+    }
+
+    /*! @} */ // End of BoolSearch group
+
+    /*!
+     * @defgroup BoolBulk Bulk Operations
+     * @{
+     */
+
+    /*!
+     * @brief Clears every flag that is clear in other.
+     *
+     * @throw std::invalid_argument if the lengths differ
+     */
+    List& and_with(const List& other) {
+        check_same_length(other);
+        for (size_t w = 0, n = words_for(count); w < n; ++w) {
+            words[w] &= other.words[w];
+        }
+        return *this;
+    }
+
+    /*!
+     * @brief Sets every flag that is set in other.
+     *
+     * @throw std::invalid_argument if the lengths differ
+     */
+    List& or_with(const List& other) {
+        check_same_length(other);
+        for (size_t w = 0, n = words_for(count); w < n; ++w) {
+            words[w] |= other.words[w];
+        }
+        return *this;
+    }
+
+    /*!
+     * @brief Flips every flag that is set in other.
+     *
+     * @throw std::invalid_argument if the lengths differ
+     */
+    List& xor_with(const List& other) {
+        check_same_length(other);
+        for (size_t w = 0, n = words_for(count); w < n; ++w) {
+            words[w] ^= other.words[w];
+        }
+        return *this;
+    }
+
+    /*!
+     * @brief Flips every flag.
+     */
+    void flip_all() {
+        size_t n = words_for(count);
+        for (size_t w = 0; w < n; ++w) {
+            words[w] = ~words[w];
+        }
+        if (n > 0) {
+            words[n - 1] &= tail_mask();
+        }
+    }
+
+    List& operator&=(const List& other) {
+        return and_with(other);
+    }
+
+    List& operator|=(const List& other) {
+        return or_with(other);
+    }
+
+    List& operator^=(const List& other) {
+        return xor_with(other);
+    }
+
+    /*! @} */ // End of BoolBulk group
+};
+
+#endif // LIST_BOOL_HPP
@@ -0,0 +1,613 @@
+/*!
+ * @file list_channel.hpp
+ * @brief Bounded producer-consumer channel that hands over whole List buffers
+ *
+ * Producers push single values; consumers pop them one by one or take everything queued at
+ * once with pop_all, which swaps the channel's buffer with the consumer's batch list instead
+ * of moving elements under the lock. A consumer that keeps passing the same batch list back
+ * ping-pongs between two buffers and never allocates once both exist.
+ *
+ * Every operation has a blocking form, a try_ form and, when the compiler supports C++20
+ * coroutines (LIST_HAS_COROUTINES is 1), an awaitable _async form. Threads and coroutines can
+ * share a channel.
+ */
+
+#ifndef LIST_CHANNEL_HPP
+#define LIST_CHANNEL_HPP
+
+#include "list.hpp"
+
+#ifndef LIST_HAS_COROUTINES
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define LIST_HAS_COROUTINES 1
+#else
+#define LIST_HAS_COROUTINES 0
+#endif
+#endif
+
+#include <condition_variable>
+#if LIST_HAS_COROUTINES
+#include <coroutine>
+#endif
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+/*!
+ * @brief Bounded multi-producer, multi-consumer channel over a List.
+ *
+ * At most capacity values are queued; push waits (or try_push fails) while the channel is
+ * full, which throttles producers to the consumers' pace. The channel's list has room for
+ * 2 * capacity elements: popped slots at the front are only reclaimed when the back runs
+ * out, so compaction costs O(1) amortized per pop.
+ *
+ * After close(), pushes fail and pops drain what is left, then report that the channel is
+ * closed. Suspended coroutines are resumed on the thread whose operation satisfied them
+ * (the producer for a pop, the consumer for a push, the caller of close), after the
+ * channel's lock has been released. A coroutine must not be destroyed while it is suspended
+ * on the channel.
+ *
+ * @tparam T The element type (move-constructible and move-assignable).
+ * @tparam Allocator Allocator of the channel's list and of the batch lists of pop_all.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class ListChannel {
+public:
+    using value_type = T;
+    using list_type = List<T, Allocator>;
+
+private:
+#if LIST_HAS_COROUTINES
+    /*!
+     * @brief A coroutine suspended in push_async, holding the value it wants to push.
+     */
+    struct PushWaiter {
+        std::coroutine_handle<> handle; ///< The suspended coroutine
+        T* value;                       ///< The value, stored in the awaiter
+        bool accepted;                  ///< Set when the value was queued, false on close
+        PushWaiter* next;               ///< Next waiter in the queue
+    };
+
+    /*!
+     * @brief A coroutine suspended in pop_async or pop_all_async on an empty channel.
+     */
+    struct PopWaiter {
+        std::coroutine_handle<> handle; ///< The suspended coroutine
+        std::optional<T>* single;       ///< Result slot of pop_async, or nullptr
+        list_type* batch;               ///< Batch list of pop_all_async, or nullptr
+        PopWaiter* next;                ///< Next waiter in the queue
+    };
+
+    /*!
+     * @brief Intrusive FIFO of waiters, whose nodes live in the awaiters.
+     */
+    template <typename Waiter>
+    struct WaitQueue {
+        Waiter* first = nullptr;
+        Waiter* last = nullptr;
+
+        bool is_empty() const {
+            return first == nullptr;
+        }
+
+        void push(Waiter* waiter) {
+            waiter->next = nullptr;
+            if (last == nullptr) {
+                first = waiter;
+            } else {
+                last->next = waiter;
+            }
+            last = waiter;
+        }
+
+        Waiter* pop() {
+            Waiter* waiter = first;
+            first = waiter->next;
+            if (first == nullptr) {
+                last = nullptr;
+            }
+            return waiter;
+        }
+
+        void resume_all() {
+            while (!is_empty()) {
+                pop()->handle.resume(); // The node dies with the awaiter; pop reads next first
+            }
+        }
+    };
+#endif
+
+    /*!
+     * @brief Coroutines to resume once the lock is released.
+     */
+    struct Wakeups {
+#if LIST_HAS_COROUTINES
+        WaitQueue<PopWaiter> pops;   ///< Pop waiters that were handed a value (or closed)
+        WaitQueue<PushWaiter> pushes; ///< Push waiters whose value was queued (or refused)
+#endif
+
+        void resume() {
+#if LIST_HAS_COROUTINES
+            pops.resume_all();
+            pushes.resume_all();
+#endif
+        }
+    };
+
+    std::mutex lock;                   ///< Guards everything below
+    std::condition_variable not_empty; ///< Signalled when blocked pops may proceed
+    std::condition_variable not_full;  ///< Signalled when blocked pushes may proceed
+    list_type items;                   ///< Queued values are items[head, items.length())
+    size_t head;                       ///< Index of the oldest queued value
+    size_t capacity;                   ///< Maximum number of queued values
+    bool closed;                       ///< Set by close()
+#if LIST_HAS_COROUTINES
+    WaitQueue<PushWaiter> push_waiters; ///< Non-empty only while the channel is full
+    WaitQueue<PopWaiter> pop_waiters;   ///< Non-empty only while the channel is empty
+#endif
+
+    size_t queued() const {
+        return items.length() - head;
+    }
+
+    /*!
+     * @brief Queues value; the channel must not be full.
+     */
+    template <typename U>
+    void append_locked(U&& value) {
+        if (items.length() == items.get_capacity() && head > 0) {
+            items.remove_range(0, head); // Only when head >= capacity, as the buffer holds 2 * capacity
+            head = 0;
+        }
+        items.add(std::forward<U>(value));
+    }
+
+    T take_front_locked() {
+        T value = std::move(items[head++]);
+        if (head == items.length()) {
+            items.clear();
+            head = 0;
+        }
+        return value;
+    }
+
+    /*!
+     * @brief Hands value to the oldest suspended consumer, or queues it if there is none.
+     */
+    template <typename U>
+    void push_locked(U&& value, Wakeups& wake) {
+#if LIST_HAS_COROUTINES
+        if (!pop_waiters.is_empty()) {
+            PopWaiter* waiter = pop_waiters.pop();
+            if (waiter->single != nullptr) {
+                waiter->single->emplace(std::forward<U>(value));
+            } else {
+                waiter->batch->add(std::forward<U>(value)); // Reserved by pop_all_async
+            }
+            wake.pops.push(waiter);
+            return;
+        }
+#endif
+        (void)wake;
+        append_locked(std::forward<U>(value));
+    }
+
+    /*!
+     * @brief Queues the values of suspended producers while there is room.
+     */
+    void refill_locked(Wakeups& wake) {
+#if LIST_HAS_COROUTINES
+        while (!push_waiters.is_empty() && queued() < capacity) {
+            PushWaiter* waiter = push_waiters.pop();
+            append_locked(std::move(*waiter->value));
+            waiter->accepted = true;
+            wake.pushes.push(waiter);
+        }
+#endif
+        (void)wake;
+    }
+
+    /*!
+     * @brief Empties out and makes sure it can become the channel's buffer.
+     *
+     * @throw std::runtime_error if out cannot hold 2 * capacity elements
+     */
+    void prepare_batch(list_type& out) const {
+        out.clear();
+        out.reserve(2 * capacity);
+    }
+
+    /*!
+     * @brief Swaps the channel's buffer with the (prepared) batch list out.
+     *
+     * @return The number of already-popped values at the front of out, to be removed.
+     */
+    size_t swap_out_locked(list_type& out) {
+        list_type batch(std::move(items));
+        items = std::move(out);
+        out = std::move(batch);
+        size_t popped = head;
+        head = 0;
+        return popped;
+    }
+
+    /*!
+     * @brief Takes every queued value into the prepared list out; the channel must not be empty.
+     */
+    size_t pop_all_locked(std::unique_lock<std::mutex>& guard, list_type& out) {
+        size_t popped = swap_out_locked(out);
+        Wakeups wake;
+        refill_locked(wake);
+        guard.unlock();
+        not_full.notify_all();
+        wake.resume();
+        out.remove_range(0, popped);
+        return out.length();
+    }
+
+    std::optional<T> pop_locked(std::unique_lock<std::mutex>& guard) {
+        std::optional<T> value(take_front_locked());
+        Wakeups wake;
+        refill_locked(wake);
+        guard.unlock();
+        not_full.notify_one();
+        wake.resume();
+        return value;
+    }
+
+    template <typename U>
+    void push_and_unlock(std::unique_lock<std::mutex>& guard, U&& value) {
+        Wakeups wake;
+        push_locked(std::forward<U>(value), wake);
+        guard.unlock();
+        not_empty.notify_one();
+        wake.resume();
+    }
+
+public:
+    /*!
+     * @defgroup ChannelInitialization Initialization
+     * @{
+     */
+
+    /*!
+     * @brief Creates an open channel holding up to capacity values, allocating its buffer once.
+     *
+     * @param capacity Maximum number of queued values. Must be > 0.
+     * @param alloc The allocator of the channel's list.
+     * @throw std::invalid_argument if capacity is 0
+     * @throw std::runtime_error if memory allocation fails
+     */
+    explicit ListChannel(size_t capacity, const Allocator& alloc = Allocator())
+        : items(alloc), head(0), capacity(capacity), closed(false) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Capacity must be greater than 0");
+        }
+        items.reserve(2 * capacity);
+    }
+
+    /*!
+     * @brief Creates an open channel over a caller-provided buffer, like List::init_static.
+     *
+     * The first pop_all moves the buffer to the consumer's batch list and gives the channel
+     * the batch list's buffer in exchange; passing a list that was itself set up with
+     * init_static over a second buffer keeps the whole exchange allocation-free.
+     *
+     * @param buffer Pointer to 2 * capacity constructed elements, owned by the caller.
+     * @param capacity Maximum number of queued values. Must be > 0.
+     * @throw std::invalid_argument if capacity is 0
+     */
+    ListChannel(T* buffer, size_t capacity) : items(), head(0), capacity(capacity), closed(false) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Capacity must be greater than 0");
+        }
+        items.init_static(buffer, 2 * capacity);
+    }
+
+    ListChannel(const ListChannel&) = delete;
+    ListChannel& operator=(const ListChannel&) = delete;
+
+    /*! @} */ // End of ChannelInitialization group
+
+    /*!
+     * @defgroup ChannelInformation Basic Information
+     * @{
+     */
+
+    /*!
+     * @brief Gets the maximum number of queued values.
+     */
+    size_t get_capacity() const {
+        return capacity;
+    }
+
+    /*!
+     * @brief Gets the number of queued values (a snapshot while other threads are active).
+     */
+    size_t length() {
+        std::lock_guard<std::mutex> guard(lock);
+        return queued();
+    }
+
+    bool is_closed() {
+        std::lock_guard<std::mutex> guard(lock);
+        return closed;
+    }
+
+    /*! @} */ // End of ChannelInformation group
+
+    /*!
+     * @defgroup ChannelProducer Producer Functions
+     * @{
+     */
+
+    /*!
+     * @brief Pushes value, blocking while the channel is full.
+     *
+     * @return true once the value is queued, false if the channel is closed.
+     */
+    template <typename U>
+    bool push(U&& value) {
+        std::unique_lock<std::mutex> guard(lock);
+        not_full.wait(guard, [&] { return closed || queued() < capacity; });
+        if (closed) {
+            return false;
+        }
+        push_and_unlock(guard, std::forward<U>(value));
+        return true;
+    }
+
+    /*!
+     * @brief Pushes value if the channel is open and not full.
+     *
+     * @return true on success, false if the channel is full or closed.
+     */
+    template <typename U>
+    bool try_push(U&& value) {
+        std::unique_lock<std::mutex> guard(lock);
+        if (closed || queued() == capacity) {
+            return false;
+        }
+        push_and_unlock(guard, std::forward<U>(value));
+        return true;
+    }
+
+    /*!
+     * @brief Closes the channel: pushes fail from now on and waiting operations return.
+     *
+     * Values already queued can still be popped.
+     */
+    void close() {
+        Wakeups wake;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            closed = true;
+#if LIST_HAS_COROUTINES
+            wake.pops = pop_waiters;
+            wake.pushes = push_waiters;
+            pop_waiters = {};
+            push_waiters = {};
+#endif
+        }
+        not_empty.notify_all();
+        not_full.notify_all();
+        wake.resume();
+    }
+
+    /*! @} */ // End of ChannelProducer group
+
+    /*!
+     * @defgroup ChannelConsumer Consumer Functions
+     * @{
+     */
+
+    /*!
+     * @brief Pops the oldest value, blocking while the channel is empty and open.
+     *
+     * @return The value, or std::nullopt once the channel is closed and drained.
+     */
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> guard(lock);
+        not_empty.wait(guard, [&] { return closed || queued() > 0; });
+        if (queued() == 0) {
+            return std::nullopt;
+        }
+        return pop_locked(guard);
+    }
+
+    /*!
+     * @brief Pops the oldest value into out if there is one.
+     *
+     * @return true on success, false if the channel is empty.
+     */
+    bool try_pop(T& out) {
+        std::unique_lock<std::mutex> guard(lock);
+        if (queued() == 0) {
+            return false;
+        }
+        out = std::move(*pop_locked(guard));
+        return true;
+    }
+
+    /*!
+     * @brief Takes every queued value at once, blocking while the channel is empty and open.
+     *
+     * out's previous contents are discarded and its buffer becomes the channel's next buffer,
+     * while out receives the channel's current one: no element is moved under the lock.
+     *
+     * @param out The batch list; reserved to 2 * capacity if needed.
+     * @return The number of values taken, 0 once the channel is closed and drained.
+     * @throw std::runtime_error if out cannot hold 2 * capacity elements
+     */
+    size_t pop_all(list_type& out) {
+        prepare_batch(out);
+        std::unique_lock<std::mutex> guard(lock);
+        not_empty.wait(guard, [&] { return closed || queued() > 0; });
+        if (queued() == 0) {
+            return 0;
+        }
+        return pop_all_locked(guard, out);
+    }
+
+    /*!
+     * @brief Takes every queued value at once if there is any (see pop_all).
+     *
+     * @return The number of values taken; 0 if the channel is empty.
+     * @throw std::runtime_error if out cannot hold 2 * capacity elements
+     */
+    size_t try_pop_all(list_type& out) {
+        prepare_batch(out);
+        std::unique_lock<std::mutex> guard(lock);
+        if (queued() == 0) {
+            return 0;
+        }
+        return pop_all_locked(guard, out);
+    }
+
+    /*! @} */ // End of ChannelConsumer group
+
+#if LIST_HAS_COROUTINES
+    /*!
+     * @defgroup ChannelCoroutines Coroutine Awaitables
+     * @{
+     */
+
+    /*!
+     * @brief Awaitable of push_async; co_await yields true once queued, false if closed.
+     */
+    class PushAwaiter {
+        ListChannel* channel;
+        T value;
+        PushWaiter node{};
+        bool result = false;
+        bool suspended = false;
+
+    public:
+        PushAwaiter(ListChannel* channel, T value) : channel(channel), value(std::move(value)) {}
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            std::unique_lock<std::mutex> guard(channel->lock);
+            if (channel->closed) {
+                return false;
+            }
+            if (channel->queued() < channel->capacity) {
+                result = true;
+                channel->push_and_unlock(guard, std::move(value));
+                return false;
+            }
+            node = PushWaiter{handle, &value, false, nullptr};
+            channel->push_waiters.push(&node);
+            suspended = true;
+            return true;
+        }
+
+        bool await_resume() const noexcept {
+            return suspended ? node.accepted : result;
+        }
+    };
+
+    /*!
+     * @brief Awaitable of pop_async; co_await yields the value, or std::nullopt once closed and drained.
+     */
+    class PopAwaiter {
+        ListChannel* channel;
+        std::optional<T> result;
+        PopWaiter node{};
+
+    public:
+        explicit PopAwaiter(ListChannel* channel) : channel(channel) {}
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            std::unique_lock<std::mutex> guard(channel->lock);
+            if (channel->queued() > 0) {
+                result = channel->pop_locked(guard);
+                return false;
+            }
+            if (channel->closed) {
+                return false;
+            }
+            node = PopWaiter{handle, &result, nullptr, nullptr};
+            channel->pop_waiters.push(&node);
+            return true;
+        }
+
+        std::optional<T> await_resume() {
+            return std::move(result);
+        }
+    };
+
+    /*!
+     * @brief Awaitable of pop_all_async; co_await yields the number of values taken.
+     *
+     * A consumer waiting on an empty channel is handed the first pushed value directly, so it
+     * resumes with a batch of one.
+     */
+    class PopAllAwaiter {
+        ListChannel* channel;
+        list_type* out;
+        PopWaiter node{};
+
+    public:
+        PopAllAwaiter(ListChannel* channel, list_type* out) : channel(channel), out(out) {}
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            std::unique_lock<std::mutex> guard(channel->lock);
+            if (channel->queued() > 0) {
+                channel->pop_all_locked(guard, *out);
+                return false;
+            }
+            if (channel->closed) {
+                return false;
+            }
+            node = PopWaiter{handle, nullptr, out, nullptr};
+            channel->pop_waiters.push(&node);
+            return true;
+        }
+
+        size_t await_resume() const noexcept {
+            return out->length();
+        }
+    };
+
+    /*!
+     * @brief co_await push_async(value) suspends while the channel is full.
+     */
+    PushAwaiter push_async(T value) {
+        return PushAwaiter(this, std::move(value));
+    }
+
+    /*!
+     * @brief co_await pop_async() suspends while the channel is empty and open.
+     */
+    PopAwaiter pop_async() {
+        return PopAwaiter(this);
+    }
+
+    /*!
+     * @brief co_await pop_all_async(out) suspends while the channel is empty and open (see pop_all).
+     *
+     * @throw std::runtime_error if out cannot hold 2 * capacity elements
+     */
+    PopAllAwaiter pop_all_async(list_type& out) {
+        prepare_batch(out);
+        return PopAllAwaiter(this, &out);
+    }
+
+    /*! @} */ // End of ChannelCoroutines group
+#endif
+};
+
+#endif // LIST_CHANNEL_HPP
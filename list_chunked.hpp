@@ -0,0 +1,537 @@
+/*!
+ * @file list_chunked.hpp
+ * @brief Growable list made of geometrically sized blocks that never relocates its elements
+ */
+
+#ifndef LIST_CHUNKED_HPP
+#define LIST_CHUNKED_HPP
+
+#include "list.hpp"
+
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*!
+ * @brief A list whose growth allocates a new block instead of reallocating the buffer.
+ *
+ * Block k holds FirstBlock << k elements, so the blocks double in size just like a List's
+ * buffer does, and an index maps to (block, offset) with one bit scan. Growth never copies
+ * or moves existing elements: the cost of an add is bounded by one allocation regardless of
+ * the list's size, and pointers returned by get_element stay valid until the element is
+ * removed or the list is cleared.
+ *
+ * The elements are not contiguous as a whole; for_each_block exposes each block as a
+ * contiguous run for bulk processing, and searches use the SIMD kernels block by block.
+ *
+ * @tparam T The element type.
+ * @tparam Allocator Allocator used for the blocks.
+ * @tparam FirstBlock Number of elements in the first block (a power of two).
+ */
+template <typename T, typename Allocator = std::allocator<T>, size_t FirstBlock = 32>
+class ChunkedList {
+    static_assert(FirstBlock > 0 && (FirstBlock & (FirstBlock - 1)) == 0, "FirstBlock must be a power of two");
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    static constexpr unsigned max_blocks = sizeof(size_t) * 8;
+
+    T* blocks[max_blocks]; ///< Block k holds FirstBlock << k elements, or is nullptr
+    unsigned block_count;  ///< Number of allocated blocks (always a prefix of blocks)
+    size_t count;          ///< The current number of elements stored
+    Allocator allocator;   ///< Source of the blocks
+
+    /*!
+     * @brief Log2 of FirstBlock.
+     */
+    static constexpr unsigned first_block_bits() {
+        unsigned bits = 0;
+        while ((size_t(1) << bits) < FirstBlock) {
+            bits++;
+        }
+        return bits;
+    }
+
+    static size_t block_size(unsigned k) {
+        return FirstBlock << k;
+    }
+
+    /*!
+     * @brief Maps an index to its block and offset with one bit scan.
+     *
+     * Block k starts at index FirstBlock * (2^k - 1), so index + FirstBlock has its highest
+     * bit at position k + log2(FirstBlock).
+     */
+    static void locate(size_t index, unsigned& block, size_t& offset) {
+        size_t biased = index + FirstBlock;
+        unsigned bit = list_detail::highest_bit(biased);
+        block = bit - first_block_bits();
+        offset = biased - (size_t(1) << bit);
+    }
+
+    T* slot(size_t index) const {
+        unsigned block;
+        size_t offset;
+        locate(index, block, offset);
+        return blocks[block] + offset;
+    }
+
+    /*!
+     * @brief Allocates the next block.
+     *
+     * @throw std::runtime_error if memory allocation fails
+     */
+    void add_block() {
+        if (block_count == max_blocks) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+        try {
+            blocks[block_count] = alloc_traits::allocate(allocator, block_size(block_count));
+        } catch (const std::bad_alloc&) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+        block_count++;
+    }
+
+    void destroy_all() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for_each_block([this](T* block, size_t n) {
+                for (size_t i = 0; i < n; ++i) {
+                    alloc_traits::destroy(allocator, block + i);
+                }
+            });
+        }
+        count = 0;
+    }
+
+    void release_blocks() {
+        for (unsigned k = 0; k < block_count; ++k) {
+            alloc_traits::deallocate(allocator, blocks[k], block_size(k));
+            blocks[k] = nullptr;
+        }
+        block_count = 0;
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+
+    /*!
+     * @brief Random-access iterator over a ChunkedList; each dereference locates the block.
+     */
+    template <bool Const>
+    class basic_iterator {
+        using list_type = std::conditional_t<Const, const ChunkedList, ChunkedList>;
+
+        list_type* list = nullptr; ///< The list iterated over
+        size_t index = 0;          ///< Current position
+
+        friend class ChunkedList;
+        template <bool>
+        friend class basic_iterator;
+
+        basic_iterator(list_type* list, size_t index) : list(list), index(index) {}
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() = default;
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& other) : list(other.list), index(other.index) {}
+
+        reference operator*() const {
+            return *list->slot(index);
+        }
+        pointer operator->() const {
+            return list->slot(index);
+        }
+        reference operator[](difference_type n) const {
+            return *list->slot(index + n);
+        }
+
+        basic_iterator& operator++() {
+            ++index;
+            return *this;
+        }
+        basic_iterator operator++(int) {
+            basic_iterator old = *this;
+            ++index;
+            return old;
+        }
+        basic_iterator& operator--() {
+            --index;
+            return *this;
+        }
+        basic_iterator operator--(int) {
+            basic_iterator old = *this;
+            --index;
+            return old;
+        }
+        basic_iterator& operator+=(difference_type n) {
+            index += n;
+            return *this;
+        }
+        basic_iterator& operator-=(difference_type n) {
+            index -= n;
+            return *this;
+        }
+        friend basic_iterator operator+(basic_iterator it, difference_type n) {
+            return it += n;
+        }
+        friend basic_iterator operator+(difference_type n, basic_iterator it) {
+            return it += n;
+        }
+        friend basic_iterator operator-(basic_iterator it, difference_type n) {
+            return it -= n;
+        }
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.index == b.index;
+        }
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return a.index != b.index;
+        }
+        friend bool operator<(const basic_iterator& a, const basic_iterator& b) {
+            return a.index < b.index;
+        }
+        friend bool operator>(const basic_iterator& a, const basic_iterator& b) {
+            return a.index > b.index;
+        }
+        friend bool operator<=(const basic_iterator& a, const basic_iterator& b) {
+            return a.index <= b.index;
+        }
+        friend bool operator>=(const basic_iterator& a, const basic_iterator& b) {
+            return a.index >= b.index;
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /*!
+     * @defgroup ChunkedInitialization Initialization and Destruction
+     * @{
+     */
+
+    /*!
+     * @brief Creates an empty list; no block is allocated until the first add.
+     */
+    explicit ChunkedList(const Allocator& alloc = Allocator())
+        : blocks(), block_count(0), count(0), allocator(alloc) {}
+
+    ChunkedList(const ChunkedList&) = delete;
+    ChunkedList& operator=(const ChunkedList&) = delete;
+
+    /*!
+     * @brief Takes over the blocks of other, leaving it empty. Element addresses are preserved.
+     */
+    ChunkedList(ChunkedList&& other) noexcept
+        : blocks(), block_count(other.block_count), count(other.count), allocator(std::move(other.allocator)) {
+        for (unsigned k = 0; k < block_count; ++k) {
+            blocks[k] = other.blocks[k];
+            other.blocks[k] = nullptr;
+        }
+        other.block_count = 0;
+        other.count = 0;
+    }
+
+    ChunkedList& operator=(ChunkedList&& other) noexcept {
+        if (this != &other) {
+            destroy_all();
+            release_blocks();
+            allocator = std::move(other.allocator);
+            block_count = other.block_count;
+            count = other.count;
+            for (unsigned k = 0; k < block_count; ++k) {
+                blocks[k] = other.blocks[k];
+                other.blocks[k] = nullptr;
+            }
+            other.block_count = 0;
+            other.count = 0;
+        }
+        return *this;
+    }
+
+    ~ChunkedList() {
+        destroy_all();
+        release_blocks();
+    }
+
+    /*! @} */ // End of ChunkedInitialization group
+
+    /*!
+     * @defgroup ChunkedInformation Basic Information
+     * @{
+     */
+
+    size_t length() const {
+        return count;
+    }
+
+    /*!
+     * @brief Gets the number of elements the allocated blocks can hold.
+     */
+    size_t get_capacity() const {
+        return FirstBlock * ((size_t(1) << block_count) - 1);
+    }
+
+    bool is_empty() const {
+        return count == 0;
+    }
+
+    /*!
+     * @brief Gets the number of allocated blocks.
+     */
+    size_t block_number() const {
+        return block_count;
+    }
+
+    Allocator get_allocator() const {
+        return allocator;
+    }
+
+    /*! @} */ // End of ChunkedInformation group
+
+    /*!
+     * @defgroup ChunkedAccess Access
+     * @{
+     */
+
+    /*!
+     * @brief Gets a pointer to the element at the specified index.
+     *
+     * The pointer stays valid while the list grows.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    T* get_element(size_t index) {
+        list_detail::check_index(index < count);
+        return slot(index);
+    }
+
+    const T* get_element(size_t index) const {
+        list_detail::check_index(index < count);
+        return slot(index);
+    }
+
+    /*!
+     * @brief Gets a reference to the element at the specified index, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    T& at(size_t index) {
+        return *get_element(index);
+    }
+
+    const T& at(size_t index) const {
+        return *get_element(index);
+    }
+
+    T& operator[](size_t index) {
+        list_detail::debug_check_index(index < count);
+        return *slot(index);
+    }
+
+    const T& operator[](size_t index) const {
+        list_detail::debug_check_index(index < count);
+        return *slot(index);
+    }
+
+    T& front() {
+        return at(0);
+    }
+
+    T& back() {
+        return at(count - 1);
+    }
+
+    const T& front() const {
+        return at(0);
+    }
+
+    const T& back() const {
+        return at(count - 1);
+    }
+
+    /*!
+     * @brief Replaces the element at the specified index.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    void set_element(size_t index, const T& value) {
+        *get_element(index) = value;
+    }
+
+    iterator begin() {
+        return iterator(this, 0);
+    }
+
+    iterator end() {
+        return iterator(this, count);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, count);
+    }
+
+    /*!
+     * @brief Calls fn(T* data, size_t n) for each block's run of elements, in order.
+     */
+    template <typename Fn>
+    void for_each_block(Fn&& fn) const {
+        size_t remaining = count;
+        for (unsigned k = 0; remaining > 0; ++k) {
+            size_t n = remaining < block_size(k) ? remaining : block_size(k);
+            fn(blocks[k], n);
+            remaining -= n;
+        }
+    }
+
+    /*! @} */ // End of ChunkedAccess group
+
+    /*!
+     * @defgroup ChunkedManipulation Element Manipulation Functions
+     * @{
+     */
+
+    /*!
+     * @brief Constructs a new element in place at the end of the list.
+     *
+     * When the last block is full a new, twice as large block is allocated; nothing is moved.
+     *
+     * @return A reference to the new element.
+     * @throw std::runtime_error if memory allocation fails
+     */
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        if (count == get_capacity()) {
+            add_block();
+        }
+        T* target = slot(count);
+        alloc_traits::construct(allocator, target, std::forward<Args>(args)...);
+        count++;
+        return *target;
+    }
+
+    void add(const T& element) {
+        emplace(element);
+    }
+
+    void add(T&& element) {
+        emplace(std::move(element));
+    }
+
+    /*!
+     * @brief Removes the element at the specified index, shifting subsequent elements left.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     */
+    void remove_at(size_t index) {
+        list_detail::check_index(index < count);
+        std::move(begin() + static_cast<std::ptrdiff_t>(index) + 1, end(), begin() + static_cast<std::ptrdiff_t>(index));
+        alloc_traits::destroy(allocator, slot(count - 1));
+        count--;
+    }
+
+    /*!
+     * @brief Removes the element at the specified index in O(1) by moving the last element into its place.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     */
+    void swap_remove(size_t index) {
+        list_detail::check_index(index < count);
+        if (index != count - 1) {
+            *slot(index) = std::move(*slot(count - 1));
+        }
+        alloc_traits::destroy(allocator, slot(count - 1));
+        count--;
+    }
+
+    /*!
+     * @brief Removes the last element.
+     *
+     * @throw std::out_of_range if the list is empty
+     */
+    void remove_last() {
+        list_detail::check_index(count > 0);
+        alloc_traits::destroy(allocator, slot(count - 1));
+        count--;
+    }
+
+    /*!
+     * @brief Allocates blocks until at least new_capacity elements fit.
+     *
+     * @throw std::runtime_error if memory allocation fails
+     */
+    void reserve(size_t new_capacity) {
+        while (get_capacity() < new_capacity) {
+            add_block();
+        }
+    }
+
+    /*!
+     * @brief Destroys all elements; the blocks are kept for reuse.
+     */
+    void clear() {
+        destroy_all();
+    }
+
+    /*! @} */ // End of ChunkedManipulation group
+
+    /*!
+     * @defgroup ChunkedSearch Search Functions
+     * @{
+     */
+
+    /*!
+     * @brief Finds the index of the first element equal to value, searching block by block.
+     *
+     * @return The zero-based index of the found element, or -1 if not found.
+     */
+    long index_of(const T& value) const {
+        size_t base = 0;
+        size_t remaining = count;
+        for (unsigned k = 0; remaining > 0; ++k) {
+            size_t n = remaining < block_size(k) ? remaining : block_size(k);
+            long found = list_simd::find_first(static_cast<const T*>(blocks[k]), n, value);
+            if (found >= 0) {
+                return static_cast<long>(base) + found;
+            }
+            base += n;
+            remaining -= n;
+        }
+        return -1;
+    }
+
+    /*!
+     * @brief Counts the elements equal to value.
+     */
+    size_t count_of(const T& value) const {
+        size_t hits = 0;
+        for_each_block([&](const T* block, size_t n) { hits += list_simd::count_equal(block, n, value); });
+        return hits;
+    }
+
+    bool contains(const T& value) const {
+        return index_of(value) >= 0;
+    }
+
+    /*! @} */ // End of ChunkedSearch group
+};
+
+#endif // LIST_CHUNKED_HPP
@@ -0,0 +1,505 @@
+/*!
+ * @file list_concurrent.hpp
+ * @brief Lock-free append-only list and bounded SPSC/MPMC rings over caller buffers
+ */
+
+#ifndef LIST_CONCURRENT_HPP
+#define LIST_CONCURRENT_HPP
+
+#include "list.hpp"
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace list_detail {
+
+/*!
+ * @brief Assumed cache line size, used to keep producer and consumer state apart.
+ */
+constexpr size_t cache_line_size = 64;
+
+/*!
+ * @brief Checks that a ring capacity is a non-zero power of two.
+ *
+ * @throw std::invalid_argument otherwise
+ */
+inline void check_ring_capacity(size_t capacity) {
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+        throw std::invalid_argument("Ring capacity must be a power of two");
+    }
+}
+
+} // namespace list_detail
+
+/*!
+ * @brief Append-only list whose add is lock-free and whose elements never move.
+ *
+ * Elements live in segments of geometrically growing size (FirstSegment, 2 * FirstSegment,
+ * 4 * FirstSegment, ...). A segment is never reallocated once published, so references and
+ * indices stay valid while other threads append. add reserves its index with one atomic
+ * increment of the reserved count, constructs the element in place and then marks its slot
+ * ready; readers may index any ready slot concurrently with writers.
+ *
+ * Concurrent use is limited to add, length, is_published, try_get and at; clear and
+ * destruction need exclusive access.
+ *
+ * @tparam T The element type.
+ * @tparam Allocator Allocator used for the segments.
+ * @tparam FirstSegment Number of slots in the first segment (a power of two).
+ */
+template <typename T, typename Allocator = std::allocator<T>, size_t FirstSegment = 32>
+class ConcurrentList {
+    static_assert(FirstSegment > 0 && (FirstSegment & (FirstSegment - 1)) == 0,
+                  "FirstSegment must be a power of two");
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+
+private:
+    /*!
+     * @brief One element and the flag that publishes it.
+     */
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)]; ///< Raw storage for the element
+        std::atomic<bool> ready;                     ///< Set (release) once the element is built
+
+        T* get() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    using slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+    using slot_traits = std::allocator_traits<slot_allocator>;
+
+    static constexpr size_t max_segments = sizeof(size_t) * 8;
+
+    alignas(list_detail::cache_line_size) std::atomic<size_t> reserved; ///< Indices handed out to writers
+    std::atomic<Slot*> segments[max_segments]; ///< Segment k holds FirstSegment << k slots
+    slot_allocator allocator;                  ///< Source of the segments
+
+    /*!
+     * @brief Log2 of FirstSegment.
+     */
+    static constexpr unsigned first_segment_bits() {
+        unsigned bits = 0;
+        while ((size_t(1) << bits) < FirstSegment) {
+            bits++;
+        }
+        return bits;
+    }
+
+    /*!
+     * @brief Number of slots in segment k.
+     */
+    static size_t segment_size(unsigned k) {
+        return FirstSegment << k;
+    }
+
+    /*!
+     * @brief Maps an index to its segment and offset with one bit scan.
+     *
+     * Segment k starts at index FirstSegment * (2^k - 1), so index + FirstSegment has its
+     * highest bit at position k + log2(FirstSegment).
+     */
+    static void locate(size_t index, unsigned& segment, size_t& offset) {
+        size_t biased = index + FirstSegment;
+        unsigned bit = list_detail::highest_bit(biased);
+        segment = bit - first_segment_bits();
+        offset = biased - (size_t(1) << bit);
+    }
+
+    /*!
+     * @brief Gets segment k, allocating and publishing it first if no thread has yet.
+     *
+     * Racing writers may both allocate; the loser of the CAS frees its copy.
+     *
+     * @throw std::bad_alloc if memory allocation fails
+     */
+    Slot* segment_for(unsigned k) {
+        Slot* segment = segments[k].load(std::memory_order_acquire);
+        if (segment != nullptr) {
+            return segment;
+        }
+
+        size_t n = segment_size(k);
+        Slot* fresh = slot_traits::allocate(allocator, n);
+        for (size_t i = 0; i < n; ++i) {
+            ::new (static_cast<void*>(&fresh[i].ready)) std::atomic<bool>(false);
+        }
+        if (segments[k].compare_exchange_strong(segment, fresh, std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+            return fresh;
+        }
+        slot_traits::deallocate(allocator, fresh, n);
+        return segment;
+    }
+
+    /*!
+     * @brief Gets the slot of index if its segment exists, nullptr otherwise.
+     */
+    Slot* find_slot(size_t index) const {
+        unsigned k;
+        size_t offset;
+        locate(index, k, offset);
+        Slot* segment = segments[k].load(std::memory_order_acquire);
+        return segment == nullptr ? nullptr : segment + offset;
+    }
+
+public:
+    /*!
+     * @defgroup ConcurrentInitialization Initialization and Destruction Functions
+     * @{
+     */
+
+    /*!
+     * @brief Creates an empty list; no segment is allocated until the first add.
+     *
+     * @param alloc The allocator to copy into the list.
+     */
+    explicit ConcurrentList(const Allocator& alloc = Allocator()) : reserved(0), allocator(alloc) {
+        for (std::atomic<Slot*>& segment : segments) {
+            segment.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    /*!
+     * @brief Destroys the elements and frees every segment. Requires exclusive access.
+     */
+    ~ConcurrentList() {
+        clear();
+        for (unsigned k = 0; k < max_segments; ++k) {
+            Slot* segment = segments[k].load(std::memory_order_relaxed);
+            if (segment != nullptr) {
+                slot_traits::deallocate(allocator, segment, segment_size(k));
+            }
+        }
+    }
+
+    ConcurrentList(const ConcurrentList&) = delete;
+    ConcurrentList& operator=(const ConcurrentList&) = delete;
+
+    /*! @} */ // End of ConcurrentInitialization group
+
+    /*!
+     * @defgroup ConcurrentOperations Concurrent Operations
+     * @{
+     */
+
+    /*!
+     * @brief Constructs an element at the next free index; safe to call from many threads.
+     *
+     * @param args Constructor arguments for the new element.
+     * @return The index the element was stored at.
+     * @throw std::bad_alloc if a new segment cannot be allocated
+     */
+    template <typename... Args>
+    size_t emplace(Args&&... args) {
+        size_t index = reserved.fetch_add(1, std::memory_order_relaxed);
+        unsigned k;
+        size_t offset;
+        locate(index, k, offset);
+        Slot& slot = segment_for(k)[offset];
+        ::new (static_cast<void*>(slot.storage)) T(std::forward<Args>(args)...);
+        slot.ready.store(true, std::memory_order_release);
+        return index;
+    }
+
+    /*!
+     * @brief Adds a copy of element; safe to call from many threads.
+     *
+     * @return The index the element was stored at.
+     * @throw std::bad_alloc if a new segment cannot be allocated
+     */
+    size_t add(const T& element) {
+        return emplace(element);
+    }
+
+    /*!
+     * @brief Moves element into the list; safe to call from many threads.
+     *
+     * @return The index the element was stored at.
+     * @throw std::bad_alloc if a new segment cannot be allocated
+     */
+    size_t add(T&& element) {
+        return emplace(std::move(element));
+    }
+
+    /*!
+     * @brief Gets the number of indices handed out, including elements still being built.
+     */
+    size_t length() const {
+        return reserved.load(std::memory_order_acquire);
+    }
+
+    /*!
+     * @brief Checks whether the element at index has been fully constructed.
+     */
+    bool is_published(size_t index) const {
+        if (index >= length()) {
+            return false;
+        }
+        Slot* slot = find_slot(index);
+        return slot != nullptr && slot->ready.load(std::memory_order_acquire);
+    }
+
+    /*!
+     * @brief Gets the element at index, or nullptr if it is not published yet.
+     */
+    const T* try_get(size_t index) const {
+        return is_published(index) ? find_slot(index)->get() : nullptr;
+    }
+
+    /*!
+     * @brief Gets the published element at index, with bounds checking.
+     *
+     * @throw std::out_of_range if index is out of bounds or its element is still being built
+     */
+    const T& at(size_t index) const {
+        const T* element = try_get(index);
+        list_detail::check_index(element != nullptr);
+        return *element;
+    }
+
+    /*! @} */ // End of ConcurrentOperations group
+
+    /*!
+     * @brief Destroys all elements, keeping the segments. Requires exclusive access.
+     */
+    void clear() {
+        size_t n = reserved.load(std::memory_order_acquire);
+        for (size_t i = 0; i < n; ++i) {
+            Slot* slot = find_slot(i);
+            if (slot != nullptr && slot->ready.load(std::memory_order_relaxed)) {
+                slot->get()->~T();
+                slot->ready.store(false, std::memory_order_relaxed);
+            }
+        }
+        reserved.store(0, std::memory_order_release);
+    }
+};
+
+/*!
+ * @brief Bounded wait-free queue for exactly one producer thread and one consumer thread.
+ *
+ * Like a List set up with init_static, the ring works inside a caller-provided buffer of
+ * already-constructed objects: try_push assigns into a slot and try_pop moves out of it. The
+ * producer and consumer positions sit on separate cache lines, and each side caches the
+ * other's position so it only touches the shared line when the ring looks full or empty.
+ *
+ * @tparam T The element type (copy- or move-assignable).
+ */
+template <typename T>
+class SpscRing {
+private:
+    T* elements = nullptr; ///< Caller-owned buffer
+    size_t mask = 0;       ///< capacity - 1
+
+    alignas(list_detail::cache_line_size) std::atomic<size_t> tail{0}; ///< Next position to write
+    size_t cached_head = 0;                                              ///< Producer's view of head
+
+    alignas(list_detail::cache_line_size) std::atomic<size_t> head{0}; ///< Next position to read
+    size_t cached_tail = 0;                                              ///< Consumer's view of tail
+
+public:
+    SpscRing() = default;
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /*!
+     * @brief Points the ring at a caller-provided buffer and empties it.
+     *
+     * Must not be called while a producer or consumer is active.
+     *
+     * @param buffer Pointer to capacity constructed elements, owned by the caller.
+     * @param capacity The number of slots (a power of two).
+     * @throw std::invalid_argument if capacity is not a power of two
+     */
+    void init_static(T* buffer, size_t capacity) {
+        list_detail::check_ring_capacity(capacity);
+        elements = buffer;
+        mask = capacity - 1;
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        cached_head = 0;
+        cached_tail = 0;
+    }
+
+    /*!
+     * @brief Gets the number of slots.
+     */
+    size_t get_capacity() const {
+        return elements == nullptr ? 0 : mask + 1;
+    }
+
+    /*!
+     * @brief Gets an approximate element count (exact when neither side is active).
+     */
+    size_t length() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    /*!
+     * @brief Adds value if there is room (producer thread only).
+     *
+     * @return true on success, false if the ring is full.
+     */
+    template <typename U>
+    bool try_push(U&& value) {
+        size_t position = tail.load(std::memory_order_relaxed);
+        if (position - cached_head == get_capacity()) {
+            cached_head = head.load(std::memory_order_acquire);
+            if (position - cached_head == get_capacity()) {
+                return false;
+            }
+        }
+        elements[position & mask] = std::forward<U>(value);
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * @brief Moves the oldest element into out if there is one (consumer thread only).
+     *
+     * @return true on success, false if the ring is empty.
+     */
+    bool try_pop(T& out) {
+        size_t position = head.load(std::memory_order_relaxed);
+        if (position == cached_tail) {
+            cached_tail = tail.load(std::memory_order_acquire);
+            if (position == cached_tail) {
+                return false;
+            }
+        }
+        out = std::move(elements[position & mask]);
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+/*!
+ * @brief Bounded lock-free queue for any number of producer and consumer threads.
+ *
+ * Implements Dmitry Vyukov's bounded MPMC queue over a caller-provided buffer of constructed
+ * objects (the init_static model). Every slot has a sequence number telling which lap of the
+ * ring it is ready for; a thread claims a position with one CAS and then publishes the slot
+ * by advancing its sequence, so producers and consumers never wait on each other's locks.
+ * The sequence numbers are allocated by the ring itself.
+ *
+ * @tparam T The element type (copy- or move-assignable).
+ */
+template <typename T>
+class MpmcRing {
+private:
+    /*!
+     * @brief Per-slot sequence number, padded to its own cache line.
+     */
+    struct alignas(list_detail::cache_line_size) Cell {
+        std::atomic<size_t> sequence;
+    };
+
+    T* elements = nullptr;         ///< Caller-owned buffer
+    std::unique_ptr<Cell[]> cells; ///< One sequence number per slot
+    size_t mask = 0;               ///< capacity - 1
+
+    alignas(list_detail::cache_line_size) std::atomic<size_t> enqueue_position{0};
+    alignas(list_detail::cache_line_size) std::atomic<size_t> dequeue_position{0};
+
+public:
+    MpmcRing() = default;
+    MpmcRing(const MpmcRing&) = delete;
+    MpmcRing& operator=(const MpmcRing&) = delete;
+
+    /*!
+     * @brief Points the ring at a caller-provided buffer and empties it.
+     *
+     * Must not be called while producers or consumers are active.
+     *
+     * @param buffer Pointer to capacity constructed elements, owned by the caller.
+     * @param capacity The number of slots (a power of two).
+     * @throw std::invalid_argument if capacity is not a power of two
+     * @throw std::bad_alloc if the sequence numbers cannot be allocated
+     */
+    void init_static(T* buffer, size_t capacity) {
+        list_detail::check_ring_capacity(capacity);
+        cells.reset(new Cell[capacity]);
+        for (size_t i = 0; i < capacity; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        elements = buffer;
+        mask = capacity - 1;
+        enqueue_position.store(0, std::memory_order_relaxed);
+        dequeue_position.store(0, std::memory_order_relaxed);
+    }
+
+    /*!
+     * @brief Gets the number of slots.
+     */
+    size_t get_capacity() const {
+        return elements == nullptr ? 0 : mask + 1;
+    }
+
+    /*!
+     * @brief Adds value if there is room; safe to call from many threads.
+     *
+     * @return true on success, false if the ring is full.
+     */
+    template <typename U>
+    bool try_push(U&& value) {
+        if (elements == nullptr) {
+            return false;
+        }
+        size_t position = enqueue_position.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[position & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t lap = static_cast<std::ptrdiff_t>(sequence - position);
+            if (lap == 0) {
+                if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    elements[position & mask] = std::forward<U>(value);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (lap < 0) {
+                return false; // The slot still holds last lap's element
+            } else {
+                position = enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /*!
+     * @brief Moves the oldest element into out if there is one; safe to call from many threads.
+     *
+     * @return true on success, false if the ring is empty.
+     */
+    bool try_pop(T& out) {
+        if (elements == nullptr) {
+            return false;
+        }
+        size_t position = dequeue_position.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[position & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t lap = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (lap == 0) {
+                if (dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    out = std::move(elements[position & mask]);
+                    cell.sequence.store(position + mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (lap < 0) {
+                return false; // Nothing has been written to this slot yet
+            } else {
+                position = dequeue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+#endif // LIST_CONCURRENT_HPP
@@ -0,0 +1,443 @@
+/*!
+ * @file list_incremental.hpp
+ * @brief Contiguous list whose growth migrates the old elements a few at a time
+ */
+
+#ifndef LIST_INCREMENTAL_HPP
+#define LIST_INCREMENTAL_HPP
+
+#include "list.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*!
+ * @brief A list that spreads the cost of growth over the operations that follow it.
+ *
+ * When an add finds the buffer full, the larger buffer is allocated and the new element is
+ * built in it, but the existing elements stay where they are. Each later add then relocates
+ * the next Step of them into the new buffer; until the last one has moved, reads check which
+ * buffer holds the requested index. The O(n) relocation of List::resize is thus taken off
+ * the add path, and once the migration completes the elements are contiguous again.
+ *
+ * Callers may also drive the migration from idle time with migrate(n), or end it at once
+ * with finish_migration(). data() and view() finish it first, since they need one buffer.
+ * Pointers to elements are invalidated when their element migrates.
+ *
+ * With the default Step and a doubling growth policy the migration always completes before
+ * the new buffer fills up; if it has not, the next growth finishes it first.
+ *
+ * @tparam T The element type.
+ * @tparam Allocator Allocator used for the buffers.
+ * @tparam Growth Growth policy choosing each new capacity.
+ * @tparam Step Number of elements migrated by each add. Must be > 0.
+ */
+template <typename T, typename Allocator = std::allocator<T>, typename Growth = GrowthDouble, size_t Step = 4>
+class IncrementalList {
+    static_assert(Step > 0, "IncrementalList must migrate at least one element per add");
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    T* elements;         ///< The current buffer
+    size_t capacity;     ///< Capacity of the current buffer
+    T* old_elements;     ///< The buffer being migrated from, or nullptr
+    size_t old_capacity; ///< Capacity of the old buffer
+    size_t old_count;    ///< Indices [migrated, old_count) still live in the old buffer
+    size_t migrated;     ///< Indices [0, migrated) have moved to the current buffer
+    size_t count;        ///< The current number of elements stored
+    Allocator allocator; ///< Source of both buffers
+
+    /*!
+     * @brief Gets the storage of index: the old buffer for not-yet-migrated indices,
+     * the current buffer otherwise (always the current buffer when no migration is pending).
+     */
+    T* slot(size_t index) const {
+        return (index >= migrated && index < old_count) ? old_elements + index : elements + index;
+    }
+
+    T* allocate_buffer(size_t n) {
+        try {
+            return alloc_traits::allocate(allocator, n);
+        } catch (const std::bad_alloc&) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+    }
+
+    /*!
+     * @brief Frees the old buffer once every element has left it.
+     */
+    void end_migration_if_done() {
+        if (old_elements != nullptr && migrated >= old_count) {
+            alloc_traits::deallocate(allocator, old_elements, old_capacity);
+            old_elements = nullptr;
+            old_capacity = 0;
+            old_count = 0;
+            migrated = 0;
+        }
+    }
+
+    /*!
+     * @brief Switches to a new buffer of new_capacity slots, leaving the elements in the old one.
+     */
+    void start_migration(T* new_elements, size_t new_capacity) {
+        if (capacity == 0) {
+            elements = new_elements;
+            capacity = new_capacity;
+            return;
+        }
+        old_elements = elements;
+        old_capacity = capacity;
+        old_count = count;
+        migrated = 0;
+        elements = new_elements;
+        capacity = new_capacity;
+        end_migration_if_done(); // An empty old buffer has nothing to migrate
+    }
+
+    void destroy_all() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < count; ++i) {
+                alloc_traits::destroy(allocator, slot(i));
+            }
+        }
+        count = 0;
+        old_count = migrated; // Nothing left to migrate
+        end_migration_if_done();
+    }
+
+    void release_storage() {
+        destroy_all();
+        if (elements != nullptr) {
+            alloc_traits::deallocate(allocator, elements, capacity);
+        }
+        elements = nullptr;
+        capacity = 0;
+    }
+
+    void take_contents(IncrementalList& other) {
+        elements = other.elements;
+        capacity = other.capacity;
+        old_elements = other.old_elements;
+        old_capacity = other.old_capacity;
+        old_count = other.old_count;
+        migrated = other.migrated;
+        count = other.count;
+        other.elements = nullptr;
+        other.capacity = 0;
+        other.old_elements = nullptr;
+        other.old_capacity = 0;
+        other.old_count = 0;
+        other.migrated = 0;
+        other.count = 0;
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+
+    /*!
+     * @defgroup IncrementalInitialization Initialization and Destruction
+     * @{
+     */
+
+    explicit IncrementalList(const Allocator& alloc = Allocator())
+        : elements(nullptr), capacity(0), old_elements(nullptr), old_capacity(0), old_count(0), migrated(0),
+          count(0), allocator(alloc) {}
+
+    IncrementalList(const IncrementalList&) = delete;
+    IncrementalList& operator=(const IncrementalList&) = delete;
+
+    IncrementalList(IncrementalList&& other) noexcept
+        : elements(nullptr), capacity(0), old_elements(nullptr), old_capacity(0), old_count(0), migrated(0),
+          count(0), allocator(std::move(other.allocator)) {
+        take_contents(other);
+    }
+
+    IncrementalList& operator=(IncrementalList&& other) noexcept {
+        if (this != &other) {
+            release_storage();
+            allocator = std::move(other.allocator);
+            take_contents(other);
+        }
+        return *this;
+    }
+
+    ~IncrementalList() {
+        release_storage();
+    }
+
+    /*! @} */ // End of IncrementalInitialization group
+
+    /*!
+     * @defgroup IncrementalInformation Basic Information and Access
+     * @{
+     */
+
+    size_t length() const {
+        return count;
+    }
+
+    /*!
+     * @brief Gets the capacity of the current buffer.
+     */
+    size_t get_capacity() const {
+        return capacity;
+    }
+
+    bool is_empty() const {
+        return count == 0;
+    }
+
+    /*!
+     * @brief Checks whether some elements still live in the previous buffer.
+     */
+    bool migration_pending() const {
+        return old_elements != nullptr;
+    }
+
+    /*!
+     * @brief Gets the number of elements still to be migrated.
+     */
+    size_t migration_remaining() const {
+        return old_count - migrated;
+    }
+
+    /*!
+     * @brief Gets a pointer to the element at the specified index.
+     *
+     * The pointer is invalidated when the element migrates.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    T* get_element(size_t index) {
+        list_detail::check_index(index < count);
+        return slot(index);
+    }
+
+    const T* get_element(size_t index) const {
+        list_detail::check_index(index < count);
+        return slot(index);
+    }
+
+    /*!
+     * @brief Gets a reference to the element at the specified index, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    T& at(size_t index) {
+        return *get_element(index);
+    }
+
+    const T& at(size_t index) const {
+        return *get_element(index);
+    }
+
+    T& operator[](size_t index) {
+        list_detail::debug_check_index(index < count);
+        return *slot(index);
+    }
+
+    const T& operator[](size_t index) const {
+        list_detail::debug_check_index(index < count);
+        return *slot(index);
+    }
+
+    /*!
+     * @brief Replaces the element at the specified index.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    void set_element(size_t index, const T& value) {
+        *get_element(index) = value;
+    }
+
+    /*!
+     * @brief Finishes any pending migration and gets the contiguous buffer.
+     */
+    T* data() {
+        finish_migration();
+        return elements;
+    }
+
+    /*!
+     * @brief Finishes any pending migration and gets a view of the elements.
+     */
+    ListView<T> view() {
+        return ListView<T>(data(), count);
+    }
+
+    /*! @} */ // End of IncrementalInformation group
+
+    /*!
+     * @defgroup IncrementalMigration Migration Control
+     * @{
+     */
+
+    /*!
+     * @brief Relocates up to n pending elements into the current buffer.
+     *
+     * @return The number of elements still to be migrated.
+     */
+    size_t migrate(size_t n) {
+        if (old_elements == nullptr) {
+            return 0;
+        }
+        size_t batch = old_count - migrated < n ? old_count - migrated : n;
+        list_detail::relocate(allocator, elements + migrated, old_elements + migrated, batch);
+        migrated += batch;
+        end_migration_if_done();
+        return migration_remaining();
+    }
+
+    /*!
+     * @brief Relocates all pending elements, leaving the list in a single buffer.
+     */
+    void finish_migration() {
+        migrate(old_count - migrated);
+    }
+
+    /*! @} */ // End of IncrementalMigration group
+
+    /*!
+     * @defgroup IncrementalManipulation Element Manipulation Functions
+     * @{
+     */
+
+    /*!
+     * @brief Constructs a new element in place at the end of the list, then migrates up to
+     * Step pending elements.
+     *
+     * When the buffer is full, a larger one is allocated and the new element is built in it;
+     * the existing elements are not moved by this call beyond the Step increment.
+     *
+     * @return A reference to the new element.
+     * @throw std::runtime_error if memory allocation fails
+     */
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        if (count == capacity) {
+            if (migration_pending()) {
+                // The arguments may refer to elements that finishing the migration moves
+                T element(std::forward<Args>(args)...);
+                finish_migration();
+                return emplace(std::move(element));
+            }
+            size_t new_capacity = Growth::grow(capacity, count + 1, sizeof(T));
+            T* new_elements = allocate_buffer(new_capacity);
+            try {
+                alloc_traits::construct(allocator, new_elements + count, std::forward<Args>(args)...);
+            } catch (...) {
+                alloc_traits::deallocate(allocator, new_elements, new_capacity);
+                throw;
+            }
+            start_migration(new_elements, new_capacity);
+        } else {
+            alloc_traits::construct(allocator, elements + count, std::forward<Args>(args)...);
+        }
+        T* added = elements + count;
+        count++;
+        migrate(Step);
+        return *added;
+    }
+
+    void add(const T& element) {
+        emplace(element);
+    }
+
+    void add(T&& element) {
+        emplace(std::move(element));
+    }
+
+    /*!
+     * @brief Removes the last element.
+     *
+     * @throw std::out_of_range if the list is empty
+     */
+    void remove_last() {
+        list_detail::check_index(count > 0);
+        alloc_traits::destroy(allocator, slot(count - 1));
+        count--;
+        if (count < old_count) {
+            old_count = count;
+        }
+        end_migration_if_done();
+    }
+
+    /*!
+     * @brief Removes the element at the specified index, shifting subsequent elements left.
+     *
+     * The shift is O(n) anyway, so any pending migration is finished first.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     */
+    void remove_at(size_t index) {
+        list_detail::check_index(index < count);
+        finish_migration();
+        std::move(elements + index + 1, elements + count, elements + index);
+        alloc_traits::destroy(allocator, elements + count - 1);
+        count--;
+    }
+
+    /*!
+     * @brief Finds the index of the first element equal to value, searching both buffers.
+     *
+     * @return The zero-based index of the found element, or -1 if not found.
+     */
+    long index_of(const T& value) const {
+        const T* current = elements;
+        long found = list_simd::find_first(current, migrated, value);
+        if (found >= 0) {
+            return found;
+        }
+        const T* previous = old_elements;
+        found = list_simd::find_first(previous + migrated, old_count - migrated, value);
+        if (found >= 0) {
+            return static_cast<long>(migrated) + found;
+        }
+        size_t tail = old_count > migrated ? old_count : migrated;
+        found = list_simd::find_first(current + tail, count - tail, value);
+        return found >= 0 ? static_cast<long>(tail) + found : -1;
+    }
+
+    bool contains(const T& value) const {
+        return index_of(value) >= 0;
+    }
+
+    /*!
+     * @brief Grows the buffer to at least new_capacity in one step, finishing any migration.
+     *
+     * @throw std::runtime_error if memory allocation fails
+     */
+    void reserve(size_t new_capacity) {
+        if (new_capacity <= capacity) {
+            return;
+        }
+        finish_migration();
+        T* new_elements = allocate_buffer(new_capacity);
+        try {
+            list_detail::relocate(allocator, new_elements, elements, count);
+        } catch (...) {
+            alloc_traits::deallocate(allocator, new_elements, new_capacity);
+            throw;
+        }
+        if (elements != nullptr) {
+            alloc_traits::deallocate(allocator, elements, capacity);
+        }
+        elements = new_elements;
+        capacity = new_capacity;
+    }
+
+    /*!
+     * @brief Destroys all elements and ends any migration; the current buffer is kept.
+     */
+    void clear() {
+        destroy_all();
+    }
+
+    /*! @} */ // End of IncrementalManipulation group
+};
+
+#endif // LIST_INCREMENTAL_HPP
@@ -0,0 +1,489 @@
+/*!
+ * @file list_indexed.hpp
+ * @brief List with an open-addressing hash index for constant-time lookups
+ */
+
+#ifndef LIST_INDEXED_HPP
+#define LIST_INDEXED_HPP
+
+#include "list.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/*!
+ * @brief A List paired with a Robin Hood hash index from value to position.
+ *
+ * index_of, contains and count_of probe the index instead of scanning, so they cost a
+ * single short probe sequence however long the list is. Equal elements share one entry,
+ * which records the first position and the count and chains the positions in order, so
+ * duplicates neither lengthen probes nor slow down add. add, set_element and swap_remove
+ * update the index incrementally; insert and remove_at shift positions, so they only mark it
+ * stale and the next lookup rebuilds it. Lists shorter than index_threshold are searched with
+ * the SIMD scan and build no index at all.
+ *
+ * Elements are only readable through const accessors, since modifying one in place would
+ * bypass the index. Lookups may build the index, so call build_index() before sharing the
+ * list between reader threads.
+ *
+ * @tparam T The element type.
+ * @tparam Hash Hash function for T.
+ * @tparam Equal Equality predicate for T.
+ * @tparam Allocator Allocator used for the element buffer.
+ */
+template <typename T, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>,
+          typename Allocator = std::allocator<T>>
+class IndexedList {
+public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    static constexpr size_t index_threshold = 64;
+
+private:
+    static constexpr size_t no_position = static_cast<size_t>(-1);
+
+    /*!
+     * @brief One index entry per distinct value, tagged with part of its hash.
+     *
+     * The positions holding the value form a chain through links, in increasing order.
+     */
+    struct Slot {
+        size_t first;         ///< Lowest position holding the value
+        size_t last;          ///< Highest position holding the value
+        size_t count;         ///< Number of positions holding the value
+        uint32_t fingerprint; ///< Low hash bits, compared before the elements themselves
+        uint32_t distance;    ///< Probe distance + 1; 0 marks an empty slot
+    };
+
+    List<T, Allocator> items;    ///< The elements
+    mutable List<Slot> table;    ///< The index, a power of two number of slots
+    mutable List<size_t> links;  ///< links[p]: next position equal to items[p], or no_position
+    mutable unsigned table_bits; ///< Log2 of the table size
+    mutable bool index_valid;    ///< false until built, after insert/remove_at and after a failed update
+    Hash hasher;                 ///< Hash function
+    Equal equal;                 ///< Equality predicate
+
+    /*!
+     * @brief Spreads the bits of the user hash (std::hash of integers is the identity).
+     */
+    uint64_t mixed_hash(const T& value) const {
+        return static_cast<uint64_t>(hasher(value)) * 0x9E3779B97F4A7C15ull;
+    }
+
+    size_t home_slot(uint64_t hash) const {
+        return static_cast<size_t>(hash >> (64 - table_bits));
+    }
+
+    size_t table_mask() const {
+        return (size_t(1) << table_bits) - 1;
+    }
+
+    /*!
+     * @brief Checks whether the table can take n entries at a load factor of at most 7/8.
+     */
+    bool fits(size_t n) const {
+        return n <= (size_t(7) << table_bits) / 8;
+    }
+
+    /*!
+     * @brief Finds the slot of value, or returns no_position.
+     */
+    size_t find_slot(const T& value, uint64_t hash) const {
+        uint32_t fingerprint = static_cast<uint32_t>(hash);
+        size_t mask = table_mask();
+        uint32_t distance = 1;
+        for (size_t i = home_slot(hash); table[i].distance >= distance; i = (i + 1) & mask, distance++) {
+            const Slot& slot = table[i];
+            if (slot.fingerprint == fingerprint && equal(items[slot.first], value)) {
+                return i;
+            }
+        }
+        return no_position;
+    }
+
+    /*!
+     * @brief Indexes items[position]; links[position] must exist.
+     *
+     * Appending a duplicate (position past every other copy, as add and rebuild do) is O(1);
+     * a position in the middle of the value's chain walks the chain to its place.
+     */
+    void insert_entry(size_t position) const {
+        uint64_t hash = mixed_hash(items[position]);
+        size_t found = find_slot(items[position], hash);
+        if (found != no_position) {
+            Slot& slot = table[found];
+            if (position > slot.last) {
+                links[slot.last] = position;
+                links[position] = no_position;
+                slot.last = position;
+            } else if (position < slot.first) {
+                links[position] = slot.first;
+                slot.first = position;
+            } else {
+                size_t previous = slot.first;
+                while (links[previous] < position) {
+                    previous = links[previous];
+                }
+                links[position] = links[previous];
+                links[previous] = position;
+            }
+            slot.count++;
+            return;
+        }
+
+        links[position] = no_position;
+        Slot entry{position, position, 1, static_cast<uint32_t>(hash), 1};
+        size_t mask = table_mask();
+        for (size_t i = home_slot(hash);; i = (i + 1) & mask, entry.distance++) {
+            Slot& slot = table[i];
+            if (slot.distance == 0) {
+                slot = entry;
+                return;
+            }
+            if (slot.distance < entry.distance) {
+                std::swap(slot, entry); // Robin Hood: the richer entry moves on
+            }
+        }
+    }
+
+    /*!
+     * @brief Unlinks position, whose element is value; drops the entry with the last copy.
+     */
+    void erase_entry(size_t position, const T& value) const {
+        size_t i = find_slot(value, mixed_hash(value));
+        Slot& slot = table[i];
+        if (--slot.count > 0) {
+            if (slot.first == position) {
+                slot.first = links[position];
+            } else {
+                size_t previous = slot.first;
+                while (links[previous] != position) {
+                    previous = links[previous];
+                }
+                links[previous] = links[position];
+                if (slot.last == position) {
+                    slot.last = previous;
+                }
+            }
+            return;
+        }
+
+        // Backward shift deletion
+        size_t mask = table_mask();
+        for (size_t next = (i + 1) & mask; table[next].distance > 1; next = (next + 1) & mask) {
+            table[i] = table[next];
+            table[i].distance--;
+            i = next;
+        }
+        table[i].distance = 0;
+    }
+
+    /*!
+     * @brief Rebuilds the index for the current elements.
+     *
+     * The index stays marked stale until the rebuild has finished, so a failed allocation
+     * leaves it to be rebuilt by the next lookup.
+     */
+    void rebuild() const {
+        index_valid = false;
+        table_bits = 6;
+        while (!fits(items.length() + 1)) {
+            table_bits++;
+        }
+        size_t slots = size_t(1) << table_bits;
+        table.clear();
+        Slot* fresh = table.append_uninitialized(slots);
+        std::memset(static_cast<void*>(fresh), 0, slots * sizeof(Slot));
+        links.clear();
+        links.append_uninitialized(items.length());
+        for (size_t position = 0; position < items.length(); ++position) {
+            insert_entry(position);
+        }
+        index_valid = true;
+    }
+
+    /*!
+     * @brief Scans the elements linearly with Equal, for short lists with a custom predicate.
+     */
+    template <typename Fn>
+    void scan_matches(const T& value, Fn&& fn) const {
+        for (size_t position = 0; position < items.length(); ++position) {
+            if (equal(items[position], value)) {
+                fn(position);
+            }
+        }
+    }
+
+    static constexpr bool default_equal = std::is_same_v<Equal, std::equal_to<T>>;
+
+    /*!
+     * @brief Builds the index if it is stale and the list is long enough to need one.
+     *
+     * @return true if lookups should use the index.
+     */
+    bool ensure_index() const {
+        if (!index_valid && items.length() >= index_threshold) {
+            rebuild();
+        }
+        return index_valid;
+    }
+
+public:
+    /*!
+     * @defgroup IndexedInitialization Initialization
+     * @{
+     */
+
+    explicit IndexedList(const Hash& hash = Hash(), const Equal& equal = Equal(), const Allocator& alloc = Allocator())
+        : items(alloc), table(), table_bits(0), index_valid(false), hasher(hash), equal(equal) {}
+
+    /*!
+     * @brief Takes over the elements of an existing list; the index is built on first lookup.
+     */
+    explicit IndexedList(List<T, Allocator>&& source, const Hash& hash = Hash(), const Equal& equal = Equal())
+        : items(std::move(source)), table(), table_bits(0), index_valid(false), hasher(hash), equal(equal) {}
+
+    /*! @} */ // End of IndexedInitialization group
+
+    /*!
+     * @defgroup IndexedInformation Basic Information and Access
+     * @{
+     */
+
+    size_t length() const {
+        return items.length();
+    }
+
+    size_t get_capacity() const {
+        return items.get_capacity();
+    }
+
+    bool is_empty() const {
+        return items.is_empty();
+    }
+
+    /*!
+     * @brief Checks whether lookups currently go through a built index.
+     */
+    bool is_index_built() const {
+        return index_valid;
+    }
+
+    /*!
+     * @brief Gets the element at the specified index, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    const T& at(size_t index) const {
+        return items.at(index);
+    }
+
+    const T& operator[](size_t index) const {
+        return items[index];
+    }
+
+    const T* data() const {
+        return items.data();
+    }
+
+    const_iterator begin() const {
+        return items.begin();
+    }
+
+    const_iterator end() const {
+        return items.end();
+    }
+
+    ListView<const T> view() const {
+        return items.view();
+    }
+
+    /*! @} */ // End of IndexedInformation group
+
+    /*!
+     * @defgroup IndexedManipulation Element Manipulation Functions
+     * @{
+     */
+
+    /*!
+     * @brief Adds an element at the end and indexes it.
+     *
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    template <typename... Args>
+    const T& emplace(Args&&... args) {
+        const T& added = items.emplace(std::forward<Args>(args)...);
+        if (index_valid) {
+            try {
+                if (fits(items.length())) {
+                    links.add(no_position);
+                    insert_entry(items.length() - 1);
+                } else {
+                    rebuild();
+                }
+            } catch (...) {
+                index_valid = false; // The element is added; the index is rebuilt later
+                throw;
+            }
+        }
+        return added;
+    }
+
+    void add(const T& element) {
+        emplace(element);
+    }
+
+    void add(T&& element) {
+        emplace(std::move(element));
+    }
+
+    /*!
+     * @brief Replaces the element at index, re-indexing just that position.
+     *
+     * If the assignment throws, the index is marked stale.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    void set_element(size_t index, const T& value) {
+        const T& old = items.at(index);
+        if (!index_valid) {
+            items.set_element(index, value);
+            return;
+        }
+        erase_entry(index, old);
+        try {
+            items.set_element(index, value);
+        } catch (...) {
+            index_valid = false;
+            throw;
+        }
+        insert_entry(index);
+    }
+
+    /*!
+     * @brief Removes the element at index by moving the last element into its place,
+     * re-indexing only the moved element.
+     *
+     * If the move throws, the index is marked stale.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    void swap_remove(size_t index) {
+        size_t last = items.length() - 1;
+        if (!index_valid || index >= items.length()) {
+            items.swap_remove(index);
+            return;
+        }
+        erase_entry(index, items[index]);
+        if (index != last) {
+            erase_entry(last, items[last]);
+        }
+        try {
+            items.swap_remove(index);
+        } catch (...) {
+            index_valid = false;
+            throw;
+        }
+        links.remove_range(last, last + 1);
+        if (index != last) {
+            insert_entry(index);
+        }
+    }
+
+    /*!
+     * @brief Inserts element at index; the index is rebuilt on the next lookup.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void insert(size_t index, const T& element) {
+        items.insert(index, element);
+        index_valid = false;
+    }
+
+    /*!
+     * @brief Removes the element at index; the index is rebuilt on the next lookup.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     */
+    void remove_at(size_t index) {
+        items.remove_at(index);
+        index_valid = false;
+    }
+
+    /*!
+     * @brief Removes all elements; the index memory is kept for reuse.
+     */
+    void clear() {
+        items.clear();
+        index_valid = false;
+    }
+
+    void reserve(size_t new_capacity) {
+        items.reserve(new_capacity);
+    }
+
+    /*! @} */ // End of IndexedManipulation group
+
+    /*!
+     * @defgroup IndexedSearch Search Functions
+     * @{
+     */
+
+    /*!
+     * @brief Builds the index now (if the list is long enough), so later lookups do not.
+     */
+    void build_index() const {
+        ensure_index();
+    }
+
+    /*!
+     * @brief Finds the index of the first element equal to value with one hash probe.
+     *
+     * @return The zero-based index of the found element, or -1 if not found.
+     */
+    long index_of(const T& value) const {
+        if (!ensure_index()) {
+            if constexpr (default_equal) {
+                return items.index_of(value);
+            } else {
+                long first = -1;
+                scan_matches(value, [&](size_t position) {
+                    first = first < 0 ? static_cast<long>(position) : first;
+                });
+                return first;
+            }
+        }
+        size_t found = find_slot(value, mixed_hash(value));
+        return found == no_position ? -1 : static_cast<long>(table[found].first);
+    }
+
+    bool contains(const T& value) const {
+        return index_of(value) >= 0;
+    }
+
+    /*!
+     * @brief Counts the elements equal to value.
+     */
+    size_t count_of(const T& value) const {
+        size_t hits = 0;
+        if (!ensure_index()) {
+            if constexpr (default_equal) {
+                return items.count_of(value);
+            } else {
+                scan_matches(value, [&](size_t) { hits++; });
+                return hits;
+            }
+        }
+        size_t found = find_slot(value, mixed_hash(value));
+        return found == no_position ? 0 : table[found].count;
+    }
+
+    /*! @} */ // End of IndexedSearch group
+};
+
+#endif // LIST_INDEXED_HPP
@@ -0,0 +1,387 @@
+/*!
+ * @file list_io.hpp
+ * @brief Binary serialization of lists of trivially copyable elements
+ *
+ * A serialized list is a ListBlobHeader followed by the raw element bytes, so writing is one
+ * bulk copy of the contiguous buffer, reading fills the list's buffer in place, and a received
+ * blob can be adopted as a List without copying at all. The byte order is the host's.
+ */
+
+#ifndef LIST_IO_HPP
+#define LIST_IO_HPP
+
+#include "list.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+#if __has_include(<unistd.h>) && __has_include(<sys/uio.h>)
+#define LIST_HAS_FD_IO 1
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#else
+#define LIST_HAS_FD_IO 0
+#endif
+
+/*!
+ * @brief Header of a serialized list.
+ */
+struct ListBlobHeader {
+    uint32_t magic;        ///< Always ListBlobHeader::expected_magic
+    uint32_t element_size; ///< sizeof(T) of the writer
+    uint64_t count;        ///< Number of elements that follow
+
+    static constexpr uint32_t expected_magic = 0x4C424C44u; // "DLBL"
+};
+
+static_assert(sizeof(ListBlobHeader) == 16, "ListBlobHeader must be 16 bytes");
+
+namespace list_detail {
+
+template <typename T>
+ListBlobHeader blob_header(size_t count) {
+    return ListBlobHeader{ListBlobHeader::expected_magic, static_cast<uint32_t>(sizeof(T)),
+                          static_cast<uint64_t>(count)};
+}
+
+/*!
+ * @brief Checks a header read back from a stream or buffer.
+ *
+ * @throw std::runtime_error if it was not written for lists of T
+ */
+template <typename T>
+void check_blob_header(const ListBlobHeader& header) {
+    if (header.magic != ListBlobHeader::expected_magic) {
+        throw std::runtime_error("Data is not a serialized list");
+    }
+    if (header.element_size != sizeof(T)) {
+        throw std::runtime_error("Serialized list has a different element size");
+    }
+}
+
+/*!
+ * @brief Marks a payload size that cannot be known before reading (pipe, socket...).
+ */
+constexpr uint64_t unknown_size = std::numeric_limits<uint64_t>::max();
+
+/*!
+ * @brief Bytes read per step when the payload size cannot be checked up front, so that a
+ * corrupt count costs at most what the source actually delivers.
+ */
+constexpr size_t read_chunk_bytes = size_t(1) << 20;
+
+/*!
+ * @brief Validates the element count of a header against the address space and the bytes
+ * that follow it.
+ *
+ * @param available Payload bytes left in the source, or unknown_size.
+ * @throw std::runtime_error if the count cannot be right
+ */
+template <typename T>
+size_t blob_count(const ListBlobHeader& header, uint64_t available) {
+    if (header.count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+        throw std::runtime_error("Serialized list is too large");
+    }
+    if (available != unknown_size && header.count > available / sizeof(T)) {
+        throw std::runtime_error("Serialized list is truncated");
+    }
+    return static_cast<size_t>(header.count);
+}
+
+/*!
+ * @brief Gets the bytes left in a seekable stream, or unknown_size; the position is kept.
+ */
+inline uint64_t stream_remaining(std::istream& is) {
+    std::istream::pos_type here = is.tellg();
+    if (here == std::istream::pos_type(-1)) {
+        return unknown_size;
+    }
+    is.seekg(0, std::ios::end);
+    std::istream::pos_type end = is.tellg();
+    is.clear();
+    is.seekg(here);
+    if (end == std::istream::pos_type(-1) || end < here || !is) {
+        is.clear();
+        return unknown_size;
+    }
+    return static_cast<uint64_t>(end - here);
+}
+
+/*!
+ * @brief Appends n elements to list with read(bytes, size), which returns false on failure.
+ *
+ * When the payload size was checked the list grows once; otherwise it grows by
+ * read_chunk_bytes at a time as data arrives. On failure the list's length is restored.
+ *
+ * @throw std::runtime_error if read fails or memory reallocation fails
+ */
+template <typename T, typename A, typename G, typename S, typename Read>
+void read_payload(List<T, A, G, S>& list, size_t n, bool size_checked, Read&& read) {
+    size_t old_length = list.length();
+    size_t step = size_checked ? n : std::max<size_t>(1, read_chunk_bytes / sizeof(T));
+    try {
+        for (size_t done = 0; done < n;) {
+            size_t batch = std::min(step, n - done);
+            T* slots = list.append_uninitialized(batch);
+            if (!read(reinterpret_cast<char*>(slots), batch * sizeof(T))) {
+                throw std::runtime_error("Failed to read list");
+            }
+            done += batch;
+        }
+    } catch (...) {
+        list.remove_range(old_length, list.length());
+        throw;
+    }
+}
+
+/*!
+ * @brief Picks the bytes per write: all of them, or chunk_elements elements at a time.
+ */
+template <typename T>
+size_t chunk_bytes(size_t total_bytes, size_t chunk_elements) {
+    return (chunk_elements == 0 || chunk_elements * sizeof(T) > total_bytes) ? total_bytes
+                                                                              : chunk_elements * sizeof(T);
+}
+
+#if LIST_HAS_FD_IO
+/*!
+ * @brief Writes all bytes to fd, retrying after partial writes and EINTR.
+ */
+inline void write_all(int fd, const char* bytes, size_t n) {
+    while (n > 0) {
+        ssize_t written = ::write(fd, bytes, n);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error("Failed to write list");
+        }
+        bytes += written;
+        n -= static_cast<size_t>(written);
+    }
+}
+
+/*!
+ * @brief Reads exactly n bytes from fd, retrying after partial reads and EINTR.
+ */
+inline void read_all(int fd, char* bytes, size_t n) {
+    while (n > 0) {
+        ssize_t got = ::read(fd, bytes, n);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            throw std::runtime_error("Failed to read list");
+        }
+        bytes += got;
+        n -= static_cast<size_t>(got);
+    }
+}
+
+/*!
+ * @brief Gets the bytes left after the current offset of a regular file, or unknown_size.
+ */
+inline uint64_t fd_remaining(int fd) {
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        return unknown_size;
+    }
+    off_t here = ::lseek(fd, 0, SEEK_CUR);
+    if (here < 0 || here > info.st_size) {
+        return unknown_size;
+    }
+    return static_cast<uint64_t>(info.st_size - here);
+}
+#endif
+
+} // namespace list_detail
+
+/*!
+ * @defgroup BinaryIO Binary Serialization
+ * @{
+ */
+
+/*!
+ * @brief Gets the number of bytes write_to produces for list.
+ */
+template <typename T, typename A, typename G, typename S>
+size_t serialized_size(const List<T, A, G, S>& list) {
+    return sizeof(ListBlobHeader) + list.length() * sizeof(T);
+}
+
+/*!
+ * @brief Writes the list to a binary stream.
+ *
+ * @param list The list to write.
+ * @param os The stream to write to (opened in binary mode).
+ * @param chunk_elements Elements per write call; 0 writes the whole buffer at once.
+ * @throw std::runtime_error if the stream fails
+ */
+template <typename T, typename A, typename G, typename S>
+void write_to(const List<T, A, G, S>& list, std::ostream& os, size_t chunk_elements = 0) {
+    static_assert(std::is_trivially_copyable_v<T>, "Binary serialization requires a trivially copyable type");
+    ListBlobHeader header = list_detail::blob_header<T>(list.length());
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    const char* bytes = reinterpret_cast<const char*>(list.data());
+    size_t remaining = list.length() * sizeof(T);
+    size_t step = list_detail::chunk_bytes<T>(remaining, chunk_elements);
+    while (remaining > 0 && os) {
+        size_t n = remaining < step ? remaining : step;
+        os.write(bytes, static_cast<std::streamsize>(n));
+        bytes += n;
+        remaining -= n;
+    }
+    if (!os) {
+        throw std::runtime_error("Failed to write list");
+    }
+}
+
+/*!
+ * @brief Reads a list written by write_to, appending its elements to list.
+ *
+ * The elements are read straight into the list's buffer. On a seekable stream the count is
+ * checked against the remaining bytes first and the list grows once; otherwise it grows in
+ * bounded steps as data arrives, so a corrupt count cannot trigger a huge allocation. If the
+ * stream ends early, the list's length is restored, though its buffer may have grown.
+ *
+ * @param list The list to append to.
+ * @param is The stream to read from (opened in binary mode).
+ * @return The number of elements read.
+ * @throw std::runtime_error if the stream fails or does not hold a list of T
+ */
+template <typename T, typename A, typename G, typename S>
+size_t read_from(List<T, A, G, S>& list, std::istream& is) {
+    static_assert(std::is_trivially_copyable_v<T>, "Binary serialization requires a trivially copyable type");
+    ListBlobHeader header;
+    if (!is.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::runtime_error("Failed to read list");
+    }
+    list_detail::check_blob_header<T>(header);
+
+    uint64_t available = list_detail::stream_remaining(is);
+    size_t n = list_detail::blob_count<T>(header, available);
+    list_detail::read_payload(list, n, available != list_detail::unknown_size, [&](char* bytes, size_t size) {
+        return static_cast<bool>(is.read(bytes, static_cast<std::streamsize>(size)));
+    });
+    return n;
+}
+
+#if LIST_HAS_FD_IO
+/*!
+ * @brief Writes the list to a file descriptor.
+ *
+ * Without chunking the header and the whole buffer go out in a single writev call (more only
+ * if the kernel accepts a partial write).
+ *
+ * @param list The list to write.
+ * @param fd The descriptor to write to (file, pipe or socket).
+ * @param chunk_elements Elements per write call; 0 writes the whole buffer at once.
+ * @throw std::runtime_error if a write fails
+ */
+template <typename T, typename A, typename G, typename S>
+void write_to(const List<T, A, G, S>& list, int fd, size_t chunk_elements = 0) {
+    static_assert(std::is_trivially_copyable_v<T>, "Binary serialization requires a trivially copyable type");
+    ListBlobHeader header = list_detail::blob_header<T>(list.length());
+    const char* bytes = reinterpret_cast<const char*>(list.data());
+    size_t remaining = list.length() * sizeof(T);
+    size_t step = list_detail::chunk_bytes<T>(remaining, chunk_elements);
+
+    // Header plus the first chunk in one system call
+    iovec parts[2] = {{&header, sizeof(header)}, {const_cast<char*>(bytes), step}};
+    ssize_t written;
+    do {
+        written = ::writev(fd, parts, remaining > 0 ? 2 : 1);
+    } while (written < 0 && errno == EINTR);
+    if (written < 0) {
+        throw std::runtime_error("Failed to write list");
+    }
+    size_t sent = static_cast<size_t>(written);
+    if (sent < sizeof(header)) {
+        list_detail::write_all(fd, reinterpret_cast<const char*>(&header) + sent, sizeof(header) - sent);
+        sent = 0;
+    } else {
+        sent -= sizeof(header);
+    }
+    bytes += sent;
+    remaining -= sent;
+
+    while (remaining > 0) {
+        size_t n = remaining < step ? remaining : step;
+        list_detail::write_all(fd, bytes, n);
+        bytes += n;
+        remaining -= n;
+    }
+}
+
+/*!
+ * @brief Reads a list written by write_to from a file descriptor, appending its elements.
+ *
+ * For regular files the count is checked against the file size first; for pipes and
+ * sockets the list grows in bounded steps as data arrives (see the stream overload). If the
+ * data ends early, the list's length is restored, though its buffer may have grown.
+ *
+ * @param list The list to append to.
+ * @param fd The descriptor to read from.
+ * @return The number of elements read.
+ * @throw std::runtime_error if a read fails, the data ends early or does not hold a list of T
+ */
+template <typename T, typename A, typename G, typename S>
+size_t read_from(List<T, A, G, S>& list, int fd) {
+    static_assert(std::is_trivially_copyable_v<T>, "Binary serialization requires a trivially copyable type");
+    ListBlobHeader header;
+    list_detail::read_all(fd, reinterpret_cast<char*>(&header), sizeof(header));
+    list_detail::check_blob_header<T>(header);
+
+    uint64_t available = list_detail::fd_remaining(fd);
+    size_t n = list_detail::blob_count<T>(header, available);
+    list_detail::read_payload(list, n, available != list_detail::unknown_size, [&](char* bytes, size_t size) {
+        list_detail::read_all(fd, bytes, size);
+        return true;
+    });
+    return n;
+}
+#endif
+
+/*!
+ * @brief Points list at the elements inside a serialized blob, without copying them.
+ *
+ * The list becomes a static list over the blob's payload (see init_static), so the blob must
+ * outlive it and the list cannot grow past the adopted elements.
+ *
+ * @param list The list to initialize.
+ * @param blob A buffer produced by write_to, e.g. a received network frame.
+ * @param size The size of the buffer in bytes.
+ * @throw std::runtime_error if the blob is truncated, misaligned or does not hold a list of T
+ */
+template <typename T, typename A, typename G, typename S>
+void adopt_buffer(List<T, A, G, S>& list, void* blob, size_t size) {
+    static_assert(std::is_trivially_copyable_v<T>, "Binary serialization requires a trivially copyable type");
+    if (size < sizeof(ListBlobHeader)) {
+        throw std::runtime_error("Data is not a serialized list");
+    }
+    ListBlobHeader header;
+    std::memcpy(&header, blob, sizeof(header));
+    list_detail::check_blob_header<T>(header);
+
+    size_t n = static_cast<size_t>(header.count);
+    if (n > (size - sizeof(ListBlobHeader)) / sizeof(T)) {
+        throw std::runtime_error("Serialized list is truncated");
+    }
+    char* payload = static_cast<char*>(blob) + sizeof(ListBlobHeader);
+    if (reinterpret_cast<uintptr_t>(payload) % alignof(T) != 0) {
+        throw std::runtime_error("Serialized list payload is misaligned for T");
+    }
+    list.init_static(reinterpret_cast<T*>(payload), n, n);
+}
+
+/*! @} */ // End of BinaryIO group
+
+#endif // LIST_IO_HPP
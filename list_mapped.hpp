@@ -0,0 +1,500 @@
+/*!
+ * @file list_mapped.hpp
+ * @brief Persistent list of trivially copyable elements stored in a memory-mapped file
+ *
+ * Available on POSIX systems, where LIST_HAS_MMAP is defined to 1.
+ */
+
+#ifndef LIST_MAPPED_HPP
+#define LIST_MAPPED_HPP
+
+#include "list.hpp"
+
+#ifndef LIST_HAS_MMAP
+#if (defined(__unix__) || defined(__APPLE__)) && __has_include(<sys/mman.h>)
+#define LIST_HAS_MMAP 1
+#else
+#define LIST_HAS_MMAP 0
+#endif
+#endif
+
+#if LIST_HAS_MMAP
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*!
+ * @brief Identifies the element type stored in a mapped file.
+ *
+ * The default hashes the compiler's spelling of T, so files written by a build with one
+ * element type are rejected by builds expecting another. Specialize value() to pin a tag
+ * that stays stable across compilers or type renames.
+ *
+ * @tparam T The element type.
+ */
+template <typename T>
+struct mapped_type_tag {
+    static uint64_t value() {
+#if defined(__GNUC__)
+        const char* name = __PRETTY_FUNCTION__;
+#else
+        const char* name = "";
+#endif
+        uint64_t hash = 14695981039346656037ull; // FNV-1a
+        for (const char* c = name; *c != '\0'; ++c) {
+            hash = (hash ^ static_cast<unsigned char>(*c)) * 1099511628211ull;
+        }
+        return hash ^ (static_cast<uint64_t>(sizeof(T)) << 48) ^ alignof(T);
+    }
+};
+
+/*!
+ * @brief Header at the start of every mapped list file, padded to one cache line.
+ */
+struct MappedListHeader {
+    uint64_t magic;        ///< Always MappedListHeader::expected_magic
+    uint32_t version;      ///< File layout version
+    uint32_t element_size; ///< sizeof(T) of the writer
+    uint64_t type_tag;     ///< mapped_type_tag<T>::value() of the writer
+    uint64_t count;        ///< Number of stored elements
+    uint64_t capacity;     ///< Number of element slots in the file
+    uint64_t reserved[3];  ///< Zero; room for future fields
+
+    static constexpr uint64_t expected_magic = 0x5453494C50414D44ull; // "DMAPLIST"
+    static constexpr uint32_t current_version = 1;
+};
+
+static_assert(sizeof(MappedListHeader) == 64, "MappedListHeader must be one cache line");
+
+/*!
+ * @brief How a MappedList opens its file.
+ */
+enum class MapMode {
+    read_write, ///< Create the file if missing; the list may grow it
+    read_only   ///< The file must exist; it is shared read-only with other processes
+};
+
+/*!
+ * @brief Growable list whose storage is a memory-mapped file.
+ *
+ * The file holds a MappedListHeader followed by the elements, so reopening it maps the data
+ * back in without reading or converting anything, and several processes may map the same file
+ * read-only. It is the managed, growable counterpart of handing init_static external memory:
+ * growth extends the file with ftruncate and remaps it (mremap on Linux) instead of allocating.
+ *
+ * Writes reach the file through the shared mapping; sync() forces them to disk.
+ *
+ * @tparam T The element type. Must be trivially copyable.
+ * @tparam Growth Policy picking the new capacity when the file is full (see Growth group).
+ */
+template <typename T, typename Growth = GrowthPageRounded<GrowthDouble>>
+class MappedList {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedList stores raw bytes, so T must be trivially copyable");
+    static_assert(alignof(T) <= sizeof(MappedListHeader), "MappedList element alignment is limited to 64 bytes");
+
+private:
+    int fd;                   ///< The open file
+    void* mapping;            ///< Start of the mapping (the header)
+    size_t mapped_bytes;      ///< Length of the mapping
+    bool read_only;           ///< Flag to indicate the file was opened with MapMode::read_only
+    MappedListHeader* header; ///< The header at the start of the mapping
+    T* elements;              ///< The element slots after the header
+
+    static size_t bytes_for(size_t capacity) {
+        return sizeof(MappedListHeader) + capacity * sizeof(T);
+    }
+
+    [[noreturn]] static void throw_errno(const char* what) {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    void attach(void* new_mapping, size_t bytes) {
+        mapping = new_mapping;
+        mapped_bytes = bytes;
+        header = static_cast<MappedListHeader*>(mapping);
+        elements = reinterpret_cast<T*>(static_cast<char*>(mapping) + sizeof(MappedListHeader));
+    }
+
+    void map_file(size_t bytes) {
+        int protection = read_only ? PROT_READ : (PROT_READ | PROT_WRITE);
+        void* new_mapping = ::mmap(nullptr, bytes, protection, MAP_SHARED, fd, 0);
+        if (new_mapping == MAP_FAILED) {
+            throw_errno("mmap failed");
+        }
+        attach(new_mapping, bytes);
+    }
+
+    void unmap() {
+        if (mapping != nullptr) {
+            ::munmap(mapping, mapped_bytes);
+            mapping = nullptr;
+            header = nullptr;
+            elements = nullptr;
+            mapped_bytes = 0;
+        }
+    }
+
+    void close_file() {
+        unmap();
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    void check_writable() const {
+        if (header == nullptr) {
+            throw std::runtime_error("List has no mapped file");
+        }
+        if (read_only) {
+            throw std::runtime_error("List is mapped read-only");
+        }
+    }
+
+    /*!
+     * @brief Checks that an existing file was written for this element type.
+     *
+     * @throw std::runtime_error if the header does not match
+     */
+    void validate(size_t file_bytes) const {
+        if (header->magic != MappedListHeader::expected_magic) {
+            throw std::runtime_error("File is not a mapped list");
+        }
+        if (header->version != MappedListHeader::current_version) {
+            throw std::runtime_error("Unsupported mapped list version");
+        }
+        if (header->element_size != sizeof(T) || header->type_tag != mapped_type_tag<T>::value()) {
+            throw std::runtime_error("Mapped file has a different element type");
+        }
+        // file_bytes >= sizeof(MappedListHeader) here; divide so a hostile capacity cannot wrap
+        if (header->count > header->capacity ||
+            header->capacity > (file_bytes - sizeof(MappedListHeader)) / sizeof(T)) {
+            throw std::runtime_error("Mapped file is truncated");
+        }
+    }
+
+    /*!
+     * @brief Extends the file to new_capacity slots and remaps it.
+     *
+     * @throw std::system_error if the file cannot be extended or remapped
+     */
+    void resize(size_t new_capacity) {
+        size_t new_bytes = bytes_for(new_capacity);
+        if (::ftruncate(fd, static_cast<off_t>(new_bytes)) != 0) {
+            throw_errno("ftruncate failed");
+        }
+#if defined(__linux__)
+        void* new_mapping = ::mremap(mapping, mapped_bytes, new_bytes, MREMAP_MAYMOVE);
+        if (new_mapping == MAP_FAILED) {
+            throw_errno("mremap failed");
+        }
+        attach(new_mapping, new_bytes);
+#else
+        unmap();
+        map_file(new_bytes);
+#endif
+        header->capacity = new_capacity;
+    }
+
+    void reserve_for(size_t n) {
+        size_t capacity = static_cast<size_t>(header->capacity);
+        size_t count = static_cast<size_t>(header->count);
+        if (n > capacity - count) {
+            resize(Growth::grow(capacity, count + n, sizeof(T)));
+        }
+    }
+
+public:
+    /*!
+     * @defgroup MappedInitialization Initialization and Destruction Functions
+     * @{
+     */
+
+    /*!
+     * @brief Opens (or, in read_write mode, creates) a mapped list file.
+     *
+     * @param path The file to map.
+     * @param mode Whether the list may modify and grow the file.
+     * @param initial_capacity Element slots of a newly created file. Must be > 0.
+     * @throw std::invalid_argument if initial_capacity is 0
+     * @throw std::system_error if the file cannot be opened, sized or mapped
+     * @throw std::runtime_error if an existing file is not a list of T
+     */
+    explicit MappedList(const std::string& path, MapMode mode = MapMode::read_write, size_t initial_capacity = 1024)
+        : fd(-1), mapping(nullptr), mapped_bytes(0), read_only(mode == MapMode::read_only), header(nullptr),
+          elements(nullptr) {
+        if (initial_capacity == 0) {
+            throw std::invalid_argument("Capacity must be greater than 0");
+        }
+
+        fd = read_only ? ::open(path.c_str(), O_RDONLY) : ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0) {
+            throw_errno("open failed");
+        }
+
+        try {
+            struct stat info;
+            if (::fstat(fd, &info) != 0) {
+                throw_errno("fstat failed");
+            }
+            size_t file_bytes = static_cast<size_t>(info.st_size);
+
+            if (file_bytes == 0 && !read_only) {
+                size_t capacity = Growth::grow(0, initial_capacity, sizeof(T));
+                file_bytes = bytes_for(capacity);
+                if (::ftruncate(fd, static_cast<off_t>(file_bytes)) != 0) {
+                    throw_errno("ftruncate failed");
+                }
+                map_file(file_bytes);
+                *header = MappedListHeader{MappedListHeader::expected_magic,
+                                           MappedListHeader::current_version,
+                                           static_cast<uint32_t>(sizeof(T)),
+                                           mapped_type_tag<T>::value(),
+                                           0,
+                                           capacity,
+                                           {0, 0, 0}};
+            } else {
+                if (file_bytes < sizeof(MappedListHeader)) {
+                    throw std::runtime_error("File is not a mapped list");
+                }
+                map_file(file_bytes);
+                validate(file_bytes);
+            }
+        } catch (...) {
+            close_file();
+            throw;
+        }
+    }
+
+    /*!
+     * @brief Unmaps and closes the file; the elements stay in it.
+     */
+    ~MappedList() {
+        close_file();
+    }
+
+    MappedList(const MappedList&) = delete;
+    MappedList& operator=(const MappedList&) = delete;
+
+    /*!
+     * @brief Move constructor; takes over other's file and mapping.
+     */
+    MappedList(MappedList&& other) noexcept
+        : fd(other.fd), mapping(other.mapping), mapped_bytes(other.mapped_bytes), read_only(other.read_only),
+          header(other.header), elements(other.elements) {
+        other.fd = -1;
+        other.mapping = nullptr;
+        other.mapped_bytes = 0;
+        other.header = nullptr;
+        other.elements = nullptr;
+    }
+
+    /*!
+     * @brief Move assignment operator; closes this list's file and takes over other's.
+     */
+    MappedList& operator=(MappedList&& other) noexcept {
+        if (this != &other) {
+            close_file();
+            std::swap(fd, other.fd);
+            std::swap(mapping, other.mapping);
+            std::swap(mapped_bytes, other.mapped_bytes);
+            std::swap(header, other.header);
+            std::swap(elements, other.elements);
+            read_only = other.read_only;
+        }
+        return *this;
+    }
+
+    /*! @} */ // End of MappedInitialization group
+
+    /*!
+     * @defgroup MappedInformation Basic Information and Access
+     * @{
+     */
+
+    /*!
+     * @brief Gets the number of stored elements (0 for a moved-from list).
+     *
+     * For a read-only mapping this is capped at the slots mapped when the file was opened,
+     * even if a writer has since appended more.
+     */
+    size_t length() const {
+        if (header == nullptr) {
+            return 0;
+        }
+        size_t count = static_cast<size_t>(header->count);
+        size_t mapped = (mapped_bytes - sizeof(MappedListHeader)) / sizeof(T);
+        return count < mapped ? count : mapped;
+    }
+
+    /*!
+     * @brief Gets the number of element slots in the file.
+     */
+    size_t get_capacity() const {
+        return header == nullptr ? 0 : static_cast<size_t>(header->capacity);
+    }
+
+    /*!
+     * @brief Checks if the list contains no elements.
+     */
+    bool is_empty() const {
+        return length() == 0;
+    }
+
+    /*!
+     * @brief Checks if the file was opened with MapMode::read_only.
+     */
+    bool is_read_only() const {
+        return read_only;
+    }
+
+    /*!
+     * @brief Gets a const reference to the element at the specified index, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    const T& at(size_t index) const {
+        list_detail::check_index(index < length());
+        return elements[index];
+    }
+
+    /*!
+     * @brief Gets a const reference to the element at the specified index (unchecked).
+     */
+    const T& operator[](size_t index) const {
+        list_detail::debug_check_index(index < length());
+        return elements[index];
+    }
+
+    /*!
+     * @brief Overwrites the element at the specified index.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     * @throw std::runtime_error if the list is mapped read-only or moved-from
+     */
+    void set_element(size_t index, const T& value) {
+        check_writable();
+        list_detail::check_index(index < length());
+        elements[index] = value;
+    }
+
+    /*!
+     * @brief Gets a const pointer to the mapped elements.
+     */
+    const T* data() const {
+        return elements;
+    }
+
+    const T* begin() const {
+        return elements;
+    }
+
+    const T* end() const {
+        return elements + length();
+    }
+
+    /*! @} */ // End of MappedInformation group
+
+    /*!
+     * @defgroup MappedManipulation Element Manipulation Functions
+     * @{
+     */
+
+    /*!
+     * @brief Appends an element, growing the file if it is full.
+     *
+     * @throw std::runtime_error if the list is mapped read-only or moved-from
+     * @throw std::system_error if the file cannot be grown
+     */
+    void add(const T& value) {
+        check_writable();
+        T copy = value; // value may live in the mapping, which growth can move
+        reserve_for(1);
+        elements[header->count] = copy;
+        header->count++;
+    }
+
+    /*!
+     * @brief Appends n elements with one copy, growing the file at most once.
+     *
+     * @param first Pointer to the elements to copy (must not point into this list).
+     * @param n Number of elements to copy.
+     * @throw std::runtime_error if the list is mapped read-only or moved-from
+     * @throw std::system_error if the file cannot be grown
+     */
+    void append(const T* first, size_t n) {
+        check_writable();
+        if (n == 0) {
+            return;
+        }
+        reserve_for(n);
+        std::memcpy(static_cast<void*>(elements + header->count), static_cast<const void*>(first), n * sizeof(T));
+        header->count += n;
+    }
+
+    /*!
+     * @brief Removes the element at the specified index, shifting subsequent elements left.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     * @throw std::runtime_error if the list is mapped read-only or moved-from
+     */
+    void remove_at(size_t index) {
+        check_writable();
+        size_t count = length();
+        list_detail::check_index(index < count);
+        std::memmove(static_cast<void*>(elements + index), static_cast<const void*>(elements + index + 1),
+                     (count - index - 1) * sizeof(T));
+        header->count--;
+    }
+
+    /*!
+     * @brief Removes all elements; the file keeps its size.
+     *
+     * @throw std::runtime_error if the list is mapped read-only or moved-from
+     */
+    void clear() {
+        check_writable();
+        header->count = 0;
+    }
+
+    /*!
+     * @brief Grows the file to at least new_capacity element slots.
+     *
+     * @throw std::runtime_error if the list is mapped read-only or moved-from
+     * @throw std::system_error if the file cannot be grown
+     */
+    void reserve(size_t new_capacity) {
+        check_writable();
+        if (new_capacity > header->capacity) {
+            resize(new_capacity);
+        }
+    }
+
+    /*!
+     * @brief Blocks until all changes have been written to the file.
+     *
+     * @throw std::system_error if msync fails
+     */
+    void sync() {
+        if (!read_only && mapping != nullptr && ::msync(mapping, mapped_bytes, MS_SYNC) != 0) {
+            throw_errno("msync failed");
+        }
+    }
+
+    /*! @} */ // End of MappedManipulation group
+};
+
+#endif // LIST_HAS_MMAP
+
+#endif // LIST_MAPPED_HPP
@@ -0,0 +1,314 @@
+/*!
+ * @file list_packed.hpp
+ * @brief Append-only integer list compressed with frame-of-reference bit packing
+ */
+
+#ifndef LIST_PACKED_HPP
+#define LIST_PACKED_HPP
+
+#include "list.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+/*!
+ * @brief Per-block metadata of a PackedIntList: the skip pointer and decoding frame.
+ */
+template <typename T>
+struct PackedBlock {
+    T base;             ///< Smallest value in the block; every value is stored as value - base
+    T max;              ///< Largest value in the block, for skipping blocks during searches
+    size_t word_offset; ///< Index of the block's first word in the packed stream
+    unsigned bits;      ///< Bits per stored value (0 when all values are equal)
+};
+
+/*!
+ * @brief An append-only list of integers stored in 128-value frame-of-reference blocks.
+ *
+ * Every full block stores its values as offsets from the block minimum, packed with just
+ * enough bits for the block's range, so sorted IDs with small gaps or values drawn from a
+ * narrow range take a fraction of sizeof(T) bytes each. Values are appended to an uncompressed
+ * tail block that is encoded once it fills.
+ *
+ * Random access is O(1): the block's entry gives the word offset and the bit width, so one
+ * or two word loads and a shift recover the value. Sequential scans and index_of decode a
+ * block at a time into a small buffer and run the SIMD search on it; searches skip blocks
+ * whose [base, max] range cannot contain the value without decoding them.
+ *
+ * @tparam T An integral element type.
+ */
+template <typename T>
+class PackedIntList {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "PackedIntList stores integers");
+    static_assert(sizeof(T) <= sizeof(uint64_t), "PackedIntList stores at most 64-bit integers");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+
+    static constexpr size_t block_size = 128;
+
+private:
+    using U = std::make_unsigned_t<T>;
+
+    List<PackedBlock<T>> blocks; ///< One entry per encoded block
+    List<uint64_t> words;        ///< The packed stream; block b uses 2 * bits words from its offset
+    T tail[block_size];          ///< The values of the block being filled, uncompressed
+    size_t tail_count;           ///< Number of values in tail
+
+    static uint64_t offset_of(T value, T base) {
+        return static_cast<uint64_t>(static_cast<U>(static_cast<U>(value) - static_cast<U>(base)));
+    }
+
+    static T value_of(uint64_t offset, T base) {
+        return static_cast<T>(static_cast<U>(static_cast<U>(base) + static_cast<U>(offset)));
+    }
+
+    static uint64_t low_mask(unsigned bits) {
+        return bits >= 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+    }
+
+    /*!
+     * @brief Encodes the full tail block into the packed stream.
+     *
+     * On failure nothing is committed: the words already appended are removed again.
+     *
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void seal_tail() {
+        T lowest = tail[0];
+        T highest = tail[0];
+        for (size_t i = 1; i < block_size; ++i) {
+            lowest = tail[i] < lowest ? tail[i] : lowest;
+            highest = tail[i] > highest ? tail[i] : highest;
+        }
+        uint64_t range = offset_of(highest, lowest);
+        unsigned bits = range == 0 ? 0 : list_detail::highest_bit(static_cast<size_t>(range)) + 1;
+
+        // 128 values of b bits fill exactly 2 * b words
+        size_t n_words = 2 * static_cast<size_t>(bits);
+        size_t word_offset = words.length();
+        if (n_words > 0) {
+            uint64_t* out = words.append_uninitialized(n_words);
+            std::memset(out, 0, n_words * sizeof(uint64_t));
+            for (size_t i = 0; i < block_size; ++i) {
+                uint64_t v = offset_of(tail[i], lowest);
+                size_t position = i * bits;
+                size_t word = position / 64;
+                unsigned shift = static_cast<unsigned>(position % 64);
+                out[word] |= v << shift;
+                if (shift + bits > 64) {
+                    out[word + 1] |= v >> (64 - shift);
+                }
+            }
+        }
+        try {
+            blocks.add(PackedBlock<T>{lowest, highest, word_offset, bits});
+        } catch (...) {
+            words.remove_range(word_offset, words.length());
+            throw;
+        }
+        tail_count = 0;
+    }
+
+    /*!
+     * @brief Decodes one value of an encoded block.
+     */
+    T decode_one(const PackedBlock<T>& block, size_t slot) const {
+        if (block.bits == 0) {
+            return block.base;
+        }
+        const uint64_t* in = words.data() + block.word_offset;
+        size_t position = slot * block.bits;
+        size_t word = position / 64;
+        unsigned shift = static_cast<unsigned>(position % 64);
+        uint64_t v = in[word] >> shift;
+        if (shift + block.bits > 64) {
+            v |= in[word + 1] << (64 - shift);
+        }
+        return value_of(v & low_mask(block.bits), block.base);
+    }
+
+    static bool may_contain(const PackedBlock<T>& block, T value) {
+        return !(value < block.base) && !(block.max < value);
+    }
+
+public:
+    /*!
+     * @defgroup PackedInitialization Initialization
+     * @{
+     */
+
+    PackedIntList() : tail(), tail_count(0) {}
+
+    PackedIntList(PackedIntList&& other) = default;
+    PackedIntList& operator=(PackedIntList&& other) = default;
+
+    /*! @} */ // End of PackedInitialization group
+
+    /*!
+     * @defgroup PackedInformation Basic Information and Access
+     * @{
+     */
+
+    size_t length() const {
+        return blocks.length() * block_size + tail_count;
+    }
+
+    bool is_empty() const {
+        return length() == 0;
+    }
+
+    /*!
+     * @brief Gets the number of encoded (full) blocks.
+     */
+    size_t block_count() const {
+        return blocks.length();
+    }
+
+    /*!
+     * @brief Gets the bytes used by the packed stream, the block table and the tail.
+     */
+    size_t memory_bytes() const {
+        return words.length() * sizeof(uint64_t) + blocks.length() * sizeof(PackedBlock<T>) + sizeof(tail);
+    }
+
+    /*!
+     * @brief Gets the value at the specified index, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    T at(size_t index) const {
+        list_detail::check_index(index < length());
+        return (*this)[index];
+    }
+
+    /*!
+     * @brief Gets the value at the specified index (unchecked).
+     */
+    T operator[](size_t index) const {
+        list_detail::debug_check_index(index < length());
+        size_t block = index / block_size;
+        if (block == blocks.length()) {
+            return tail[index % block_size];
+        }
+        return decode_one(blocks[block], index % block_size);
+    }
+
+    /*!
+     * @brief Decodes block b (b < block_count()) into out[0, block_size).
+     */
+    void decode_block(size_t b, T* out) const {
+        const PackedBlock<T>& block = blocks.at(b);
+        if (block.bits == 0) {
+            for (size_t i = 0; i < block_size; ++i) {
+                out[i] = block.base;
+            }
+            return;
+        }
+        const uint64_t* in = words.data() + block.word_offset;
+        uint64_t mask = low_mask(block.bits);
+        size_t position = 0;
+        for (size_t i = 0; i < block_size; ++i, position += block.bits) {
+            size_t word = position / 64;
+            unsigned shift = static_cast<unsigned>(position % 64);
+            uint64_t v = in[word] >> shift;
+            if (shift + block.bits > 64) {
+                v |= in[word + 1] << (64 - shift);
+            }
+            out[i] = value_of(v & mask, block.base);
+        }
+    }
+
+    /*!
+     * @brief Calls fn(value) for every value in order, decoding a block at a time.
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        T decoded[block_size];
+        for (size_t b = 0; b < blocks.length(); ++b) {
+            decode_block(b, decoded);
+            for (size_t i = 0; i < block_size; ++i) {
+                fn(decoded[i]);
+            }
+        }
+        for (size_t i = 0; i < tail_count; ++i) {
+            fn(tail[i]);
+        }
+    }
+
+    /*! @} */ // End of PackedInformation group
+
+    /*!
+     * @defgroup PackedManipulation Element Manipulation Functions
+     * @{
+     */
+
+    /*!
+     * @brief Appends a value; every block_size-th add encodes the completed block.
+     *
+     * If encoding fails the value is not added, so the tail never stays full.
+     *
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void add(T value) {
+        tail[tail_count++] = value;
+        if (tail_count == block_size) {
+            try {
+                seal_tail();
+            } catch (...) {
+                tail_count--;
+                throw;
+            }
+        }
+    }
+
+    /*!
+     * @brief Removes all values, keeping the allocated buffers.
+     */
+    void clear() {
+        blocks.clear();
+        words.clear();
+        tail_count = 0;
+    }
+
+    /*! @} */ // End of PackedManipulation group
+
+    /*!
+     * @defgroup PackedSearch Search Functions
+     * @{
+     */
+
+    /*!
+     * @brief Finds the index of the first value equal to value.
+     *
+     * Blocks whose [base, max] range excludes value are skipped without decoding.
+     *
+     * @return The zero-based index of the found value, or -1 if not found.
+     */
+    long index_of(T value) const {
+        T decoded[block_size];
+        for (size_t b = 0; b < blocks.length(); ++b) {
+            if (!may_contain(blocks[b], value)) {
+                continue;
+            }
+            decode_block(b, decoded);
+            long found = list_simd::find_first(static_cast<const T*>(decoded), block_size, value);
+            if (found >= 0) {
+                return static_cast<long>(b * block_size) + found;
+            }
+        }
+        long found = list_simd::find_first(static_cast<const T*>(tail), tail_count, value);
+        return found >= 0 ? static_cast<long>(blocks.length() * block_size) + found : -1;
+    }
+
+    bool contains(T value) const {
+        return index_of(value) >= 0;
+    }
+
+    /*! @} */ // End of PackedSearch group
+};
+
+#endif // LIST_PACKED_HPP
@@ -0,0 +1,580 @@
+/*!
+ * @file list_parallel.hpp
+ * @brief Parallel algorithms over List's contiguous storage, on a work-stealing thread pool
+ *
+ * Overloads taking a standard execution policy are declared when <execution> has been
+ * included before this header. This header does not include it itself: with some standard
+ * libraries <execution> pulls in TBB and then needs -ltbb at link time.
+ */
+
+#ifndef LIST_PARALLEL_HPP
+#define LIST_PARALLEL_HPP
+
+#include "list.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace list_parallel {
+
+class ThreadPool;
+
+namespace detail {
+
+inline thread_local ThreadPool* current_pool = nullptr; ///< Pool owning the calling thread, if any
+inline thread_local size_t current_worker = 0;          ///< Index of the calling worker in that pool
+
+} // namespace detail
+
+/*!
+ * @brief Fixed-size thread pool with one task deque per worker and work stealing.
+ *
+ * A worker pushes and pops tasks at the back of its own deque, so recently spawned (cache-hot)
+ * work runs first, and steals from the front of other workers' deques when its own is empty.
+ * Tasks submitted from outside the pool are spread round-robin. Threads waiting on parallel
+ * work run queued tasks instead of blocking, so algorithms may nest.
+ */
+class ThreadPool {
+private:
+    /*!
+     * @brief One worker's task deque.
+     */
+    struct Queue {
+        std::mutex lock;                         ///< Guards tasks
+        std::deque<std::function<void()>> tasks; ///< Owner uses the back, thieves the front
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues; ///< One per worker
+    std::vector<std::thread> threads;           ///< The workers
+    std::atomic<size_t> pending{0};             ///< Tasks queued but not yet taken
+    std::atomic<size_t> next_queue{0};          ///< Round-robin target for outside submissions
+    std::mutex sleep_lock;                      ///< Guards stopping and the wake-up condition
+    std::condition_variable wake;               ///< Signals idle workers
+    bool stopping = false;                      ///< Set by the destructor
+
+    /*!
+     * @brief Takes a task: the back of the caller's own deque first, then the front of the others.
+     */
+    bool take_task(std::function<void()>& task) {
+        size_t n = queues.size();
+        size_t own = (detail::current_pool == this) ? detail::current_worker : next_queue.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < n; ++i) {
+            Queue& queue = *queues[(own + i) % n];
+            std::lock_guard<std::mutex> guard(queue.lock);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            if (i == 0 && detail::current_pool == this) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    void worker_loop(size_t index) {
+        detail::current_pool = this;
+        detail::current_worker = index;
+        std::function<void()> task;
+        for (;;) {
+            if (take_task(task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> guard(sleep_lock);
+            wake.wait(guard, [this]() { return stopping || pending.load(std::memory_order_relaxed) > 0; });
+            if (stopping && pending.load(std::memory_order_relaxed) == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    /*!
+     * @brief Starts the worker threads.
+     *
+     * @param thread_count Number of workers; 0 makes every algorithm run on the calling thread.
+     */
+    explicit ThreadPool(size_t thread_count) {
+        for (size_t i = 0; i < thread_count; ++i) {
+            queues.push_back(std::make_unique<Queue>());
+        }
+        for (size_t i = 0; i < thread_count; ++i) {
+            threads.emplace_back([this, i]() { worker_loop(i); });
+        }
+    }
+
+    /*!
+     * @brief Runs the remaining tasks, then joins the workers.
+     */
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> guard(sleep_lock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /*!
+     * @brief Gets the number of worker threads.
+     */
+    size_t size() const {
+        return threads.size();
+    }
+
+    /*!
+     * @brief Queues a task; a worker pushes onto its own deque, other threads round-robin.
+     *
+     * With no workers the task runs immediately on the calling thread.
+     *
+     * @param task The work to run.
+     */
+    void submit(std::function<void()> task) {
+        if (queues.empty()) {
+            task();
+            return;
+        }
+        size_t index = (detail::current_pool == this)
+                           ? detail::current_worker
+                           : next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+        {
+            std::lock_guard<std::mutex> guard(queues[index]->lock);
+            queues[index]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> guard(sleep_lock);
+            pending.fetch_add(1, std::memory_order_relaxed);
+        }
+        wake.notify_one();
+    }
+
+    /*!
+     * @brief Runs one queued task on the calling thread, if any is available.
+     *
+     * @return true if a task was run.
+     */
+    bool try_run_one() {
+        std::function<void()> task;
+        if (take_task(task)) {
+            task();
+            return true;
+        }
+        return false;
+    }
+};
+
+/*!
+ * @brief Gets the shared pool used when no other is given.
+ *
+ * It has one worker fewer than the hardware has threads, since the calling thread takes part
+ * in every algorithm.
+ */
+inline ThreadPool& default_pool() {
+    static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+/*!
+ * @brief Tuning for the parallel algorithms.
+ */
+struct ParallelOptions {
+    size_t grain = 0;           ///< Elements per task; 0 picks about four tasks per thread (at least 4096 elements)
+    ThreadPool* pool = nullptr; ///< Pool to run on; nullptr means default_pool()
+
+    /*!
+     * @brief Options that run everything as a single task on the calling thread.
+     */
+    static ParallelOptions sequential() {
+        return {static_cast<size_t>(-1), nullptr};
+    }
+};
+
+namespace detail {
+
+/*!
+ * @brief Picks the pool for a call.
+ */
+inline ThreadPool& pool_for(const ParallelOptions& options) {
+    return options.pool != nullptr ? *options.pool : default_pool();
+}
+
+/*!
+ * @brief Picks the elements per chunk for n elements.
+ */
+inline size_t grain_for(size_t n, const ParallelOptions& options, const ThreadPool& pool) {
+    if (options.grain != 0) {
+        return options.grain;
+    }
+    size_t tasks = 4 * (pool.size() + 1);
+    return std::max<size_t>(4096, (n + tasks - 1) / tasks);
+}
+
+/*!
+ * @brief Runs body(c) for every chunk c in [0, chunks) on the pool and the calling thread.
+ *
+ * Chunks are claimed in increasing order from a shared counter, so early chunks finish first.
+ * The first exception thrown by body stops the remaining chunks and is rethrown here.
+ */
+template <typename Body>
+void run_chunks(size_t chunks, const Body& body, ThreadPool& pool) {
+    if (chunks == 0) {
+        return;
+    }
+    if (chunks == 1 || pool.size() == 0) {
+        for (size_t c = 0; c < chunks; ++c) {
+            body(c);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> helpers_running{0};
+    std::exception_ptr error;
+    std::mutex error_lock;
+
+    auto work = [&]() {
+        for (size_t c = next.fetch_add(1, std::memory_order_relaxed); c < chunks;
+             c = next.fetch_add(1, std::memory_order_relaxed)) {
+            try {
+                body(c);
+            } catch (...) {
+                std::lock_guard<std::mutex> guard(error_lock);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                next.store(chunks, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    // Helpers reference work, next and error on this frame, so only count the ones actually
+    // queued, and wait for all of them even if queuing the rest fails. A helper finishing
+    // before its increment only wraps the counter around for a moment.
+    size_t helpers = std::min(pool.size(), chunks - 1);
+    try {
+        for (size_t i = 0; i < helpers; ++i) {
+            pool.submit([&]() {
+                work();
+                helpers_running.fetch_sub(1, std::memory_order_release);
+            });
+            helpers_running.fetch_add(1, std::memory_order_relaxed);
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> guard(error_lock);
+        if (!error) {
+            error = std::current_exception();
+        }
+        next.store(chunks, std::memory_order_relaxed);
+    }
+    work();
+    while (helpers_running.load(std::memory_order_acquire) != 0) {
+        if (!pool.try_run_one()) {
+            std::this_thread::yield();
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/*!
+ * @brief Runs body(begin, end) over [0, n) split into grain-sized chunks.
+ */
+template <typename Body>
+void run_ranges(size_t n, const ParallelOptions& options, const Body& body) {
+    ThreadPool& pool = pool_for(options);
+    size_t grain = grain_for(n, options, pool);
+    size_t chunks = (grain >= n) ? (n > 0 ? 1 : 0) : (n + grain - 1) / grain;
+    run_chunks(chunks, [&](size_t c) {
+        size_t begin = c * grain;
+        body(begin, std::min(n, begin + grain));
+    }, pool);
+}
+
+#if defined(__cpp_lib_execution)
+/*!
+ * @brief Maps a standard execution policy to options: sequenced runs on the calling thread.
+ */
+template <typename Policy>
+ParallelOptions options_for_policy(const Policy&) {
+    if constexpr (std::is_same_v<std::decay_t<Policy>, std::execution::sequenced_policy>) {
+        return ParallelOptions::sequential();
+    } else {
+        return ParallelOptions();
+    }
+}
+
+template <typename Policy, typename R = void>
+using enable_if_policy = std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, R>;
+#endif
+
+} // namespace detail
+
+/*!
+ * @defgroup ParallelAlgorithms Parallel Algorithms
+ *
+ * Every algorithm splits the list into chunks of ParallelOptions::grain elements that run as
+ * tasks on a ThreadPool, with the calling thread taking part. The list must not be resized
+ * while an algorithm runs.
+ * @{
+ */
+
+/*!
+ * @brief Calls fn on every element, in parallel.
+ *
+ * @param list The list whose elements to visit.
+ * @param fn Callable taking T&; called concurrently from several threads.
+ * @param options Grain size and pool.
+ */
+template <typename T, typename A, typename G, typename S, typename Fn>
+void parallel_for_each(List<T, A, G, S>& list, Fn fn, const ParallelOptions& options = ParallelOptions()) {
+    T* data = list.data();
+    detail::run_ranges(list.length(), options, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            fn(data[i]);
+        }
+    });
+}
+
+/*!
+ * @brief Stores fn(in[i]) into out[i] for every element, in parallel.
+ *
+ * out is first resized to in.length(): surplus elements are removed and missing ones
+ * default-constructed, then every slot is assigned in parallel.
+ *
+ * @param in The source list.
+ * @param out The destination list (may be the same list as in).
+ * @param fn Callable mapping const T& to a value assignable to U.
+ * @param options Grain size and pool.
+ * @throw std::runtime_error if out cannot grow
+ */
+template <typename T, typename A, typename G, typename S, typename U, typename A2, typename G2, typename S2,
+          typename Fn>
+void parallel_transform(const List<T, A, G, S>& in, List<U, A2, G2, S2>& out, Fn fn,
+                        const ParallelOptions& options = ParallelOptions()) {
+    size_t n = in.length();
+    if (static_cast<const void*>(&in) != static_cast<const void*>(&out)) {
+        if (out.length() > n) {
+            out.remove_range(n, out.length());
+        }
+        out.reserve(n);
+        while (out.length() < n) {
+            out.emplace();
+        }
+    }
+    const T* source = in.data();
+    U* destination = out.data();
+    detail::run_ranges(n, options, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            destination[i] = fn(source[i]);
+        }
+    });
+}
+
+/*!
+ * @brief Folds all elements with op, in parallel.
+ *
+ * Each chunk is folded on its own and the partial results are combined in chunk order, so op
+ * must be associative; unlike std::accumulate it need not be commutative.
+ *
+ * @param list The list to fold.
+ * @param init The initial value, combined first.
+ * @param op Associative callable combining two values.
+ * @param options Grain size and pool.
+ * @return init op list[0] op ... op list[n - 1].
+ */
+template <typename T, typename A, typename G, typename S, typename R, typename Op = std::plus<>>
+R parallel_reduce(const List<T, A, G, S>& list, R init, Op op = Op(),
+                  const ParallelOptions& options = ParallelOptions()) {
+    ThreadPool& pool = detail::pool_for(options);
+    size_t n = list.length();
+    size_t grain = detail::grain_for(n, options, pool);
+    size_t chunks = (n == 0) ? 0 : (grain >= n ? 1 : (n + grain - 1) / grain);
+    const T* data = list.data();
+
+    std::vector<std::optional<R>> partials(chunks);
+    detail::run_chunks(chunks, [&](size_t c) {
+        size_t begin = c * grain;
+        size_t end = std::min(n, begin + grain);
+        R partial(data[begin]);
+        for (size_t i = begin + 1; i < end; ++i) {
+            partial = op(std::move(partial), data[i]);
+        }
+        partials[c].emplace(std::move(partial));
+    }, pool);
+
+    for (std::optional<R>& partial : partials) {
+        init = op(std::move(init), std::move(*partial));
+    }
+    return init;
+}
+
+/*!
+ * @brief Finds the first element satisfying pred, in parallel, stopping early.
+ *
+ * Chunks are handed out in index order; once a match is found, chunks starting after it are
+ * skipped, so the search finishes soon after the first match's chunk.
+ *
+ * @param list The list to search.
+ * @param pred Callable taking const T& and returning bool.
+ * @param options Grain size and pool.
+ * @return The zero-based index of the first matching element, or -1 if none matches.
+ */
+template <typename T, typename A, typename G, typename S, typename Pred>
+long parallel_find_if(const List<T, A, G, S>& list, Pred pred, const ParallelOptions& options = ParallelOptions()) {
+    size_t n = list.length();
+    const T* data = list.data();
+    std::atomic<size_t> best{n};
+    detail::run_ranges(n, options, [&](size_t begin, size_t end) {
+        if (begin >= best.load(std::memory_order_relaxed)) {
+            return;
+        }
+        for (size_t i = begin; i < end; ++i) {
+            if (pred(data[i])) {
+                size_t current = best.load(std::memory_order_relaxed);
+                while (i < current && !best.compare_exchange_weak(current, i, std::memory_order_relaxed)) {
+                }
+                return;
+            }
+        }
+    });
+    size_t found = best.load(std::memory_order_relaxed);
+    return found < n ? static_cast<long>(found) : -1;
+}
+
+/*!
+ * @brief Finds the first element equal to value, in parallel, stopping early.
+ *
+ * Each chunk is scanned with the same vectorized kernels as List::index_of.
+ *
+ * @param list The list to search.
+ * @param value The value to search for.
+ * @param options Grain size and pool.
+ * @return The zero-based index of the first match, or -1 if not found.
+ */
+template <typename T, typename A, typename G, typename S>
+long parallel_find(const List<T, A, G, S>& list, const T& value, const ParallelOptions& options = ParallelOptions()) {
+    size_t n = list.length();
+    const T* data = list.data();
+    std::atomic<size_t> best{n};
+    detail::run_ranges(n, options, [&](size_t begin, size_t end) {
+        if (begin >= best.load(std::memory_order_relaxed)) {
+            return;
+        }
+        long hit = list_simd::find_first(data + begin, end - begin, value);
+        if (hit >= 0) {
+            size_t i = begin + static_cast<size_t>(hit);
+            size_t current = best.load(std::memory_order_relaxed);
+            while (i < current && !best.compare_exchange_weak(current, i, std::memory_order_relaxed)) {
+            }
+        }
+    });
+    size_t found = best.load(std::memory_order_relaxed);
+    return found < n ? static_cast<long>(found) : -1;
+}
+
+/*!
+ * @brief Sorts the list, in parallel.
+ *
+ * Chunks are sorted independently, then merged pairwise in rounds of doubling width, each
+ * round running its merges in parallel. Not stable.
+ *
+ * @param list The list to sort.
+ * @param comp Strict weak ordering.
+ * @param options Grain size and pool.
+ */
+template <typename T, typename A, typename G, typename S, typename Compare = std::less<T>>
+void parallel_sort(List<T, A, G, S>& list, Compare comp = Compare(), const ParallelOptions& options = ParallelOptions()) {
+    ThreadPool& pool = detail::pool_for(options);
+    size_t n = list.length();
+    size_t grain = detail::grain_for(n, options, pool);
+    size_t chunks = (n == 0) ? 0 : (grain >= n ? 1 : (n + grain - 1) / grain);
+    T* data = list.data();
+
+    detail::run_chunks(chunks, [&](size_t c) {
+        size_t begin = c * grain;
+        std::sort(data + begin, data + std::min(n, begin + grain), comp);
+    }, pool);
+
+    for (size_t width = 1; width < chunks; width *= 2) {
+        size_t merges = (chunks + 2 * width - 1) / (2 * width);
+        detail::run_chunks(merges, [&](size_t m) {
+            size_t begin = m * 2 * width * grain;
+            size_t middle = std::min(n, begin + width * grain);
+            size_t end = std::min(n, begin + 2 * width * grain);
+            if (middle < end) {
+                std::inplace_merge(data + begin, data + middle, data + end, comp);
+            }
+        }, pool);
+    }
+}
+
+#if defined(__cpp_lib_execution)
+/*!
+ * @brief Overloads taking a standard execution policy instead of ParallelOptions.
+ *
+ * std::execution::seq runs on the calling thread; every other policy runs on default_pool().
+ */
+
+template <typename Policy, typename T, typename A, typename G, typename S, typename Fn>
+detail::enable_if_policy<Policy> parallel_for_each(Policy&& policy, List<T, A, G, S>& list, Fn fn) {
+    parallel_for_each(list, fn, detail::options_for_policy(policy));
+}
+
+template <typename Policy, typename T, typename A, typename G, typename S, typename U, typename A2, typename G2,
+          typename S2, typename Fn>
+detail::enable_if_policy<Policy> parallel_transform(Policy&& policy, const List<T, A, G, S>& in,
+                                                    List<U, A2, G2, S2>& out, Fn fn) {
+    parallel_transform(in, out, fn, detail::options_for_policy(policy));
+}
+
+template <typename Policy, typename T, typename A, typename G, typename S, typename R, typename Op = std::plus<>>
+detail::enable_if_policy<Policy, R> parallel_reduce(Policy&& policy, const List<T, A, G, S>& list, R init,
+                                                    Op op = Op()) {
+    return parallel_reduce(list, std::move(init), op, detail::options_for_policy(policy));
+}
+
+template <typename Policy, typename T, typename A, typename G, typename S>
+detail::enable_if_policy<Policy, long> parallel_find(Policy&& policy, const List<T, A, G, S>& list, const T& value) {
+    return parallel_find(list, value, detail::options_for_policy(policy));
+}
+
+template <typename Policy, typename T, typename A, typename G, typename S, typename Pred>
+detail::enable_if_policy<Policy, long> parallel_find_if(Policy&& policy, const List<T, A, G, S>& list, Pred pred) {
+    return parallel_find_if(list, pred, detail::options_for_policy(policy));
+}
+
+template <typename Policy, typename T, typename A, typename G, typename S, typename Compare = std::less<T>>
+detail::enable_if_policy<Policy> parallel_sort(Policy&& policy, List<T, A, G, S>& list, Compare comp = Compare()) {
+    parallel_sort(list, comp, detail::options_for_policy(policy));
+}
+#endif
+
+/*! @} */ // End of ParallelAlgorithms group
+
+} // namespace list_parallel
+
+#endif // LIST_PARALLEL_HPP
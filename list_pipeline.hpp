@@ -0,0 +1,335 @@
+/*!
+ * @file list_pipeline.hpp
+ * @brief Lazy, fused filter / map / take pipelines over lists
+ *
+ *     using namespace list_pipeline;
+ *     List<Row> report = rows | filter(is_open) | map(to_row) | take(100) | collect();
+ *
+ * No stage stores elements. Each stage pushes values into the next through a callback, so
+ * after inlining the whole chain runs as a single loop over the source buffer, and only the
+ * final collect() allocates. When no filter is involved the output size is known up front and
+ * collect() reserves it exactly once.
+ *
+ * A pipeline refers to its source list without owning it, like a ListView: the list must
+ * outlive the pipeline and must not reallocate while the pipeline runs.
+ */
+
+#ifndef LIST_PIPELINE_HPP
+#define LIST_PIPELINE_HPP
+
+#include "list.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace list_pipeline {
+
+/*!
+ * @defgroup Pipeline Lazy Pipelines
+ * @{
+ */
+
+template <typename Derived>
+class Stage;
+
+namespace detail {
+
+template <typename T, typename = void>
+struct is_stage : std::false_type {};
+
+template <typename T>
+struct is_stage<T, std::enable_if_t<std::is_base_of_v<Stage<T>, T>>> : std::true_type {};
+
+template <typename C, typename = void>
+struct is_list_like : std::false_type {};
+
+template <typename C>
+struct is_list_like<C, std::void_t<decltype(std::declval<const C&>().data()), decltype(std::declval<const C&>().length())>>
+    : std::true_type {};
+
+template <typename C>
+using element_of = std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<const C&>().data())>>;
+
+} // namespace detail
+
+/*!
+ * @brief Common terminal operations of every pipeline stage.
+ *
+ * A stage provides run(sink), which pushes each value into sink(value) until sink returns
+ * false, plus size_bound() and the constant exact_size telling whether that bound is exact.
+ */
+template <typename Derived>
+class Stage {
+    const Derived& self() const {
+        return static_cast<const Derived&>(*this);
+    }
+
+public:
+    /*!
+     * @brief Calls fn(value) for every value of the pipeline.
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        self().run([&](auto&& value) {
+            fn(std::forward<decltype(value)>(value));
+            return true;
+        });
+    }
+
+    /*!
+     * @brief Counts the values of the pipeline without storing them.
+     */
+    size_t count() const {
+        if constexpr (Derived::exact_size) {
+            return self().size_bound();
+        } else {
+            size_t n = 0;
+            self().run([&](auto&&) {
+                n++;
+                return true;
+            });
+            return n;
+        }
+    }
+
+    /*!
+     * @brief Appends the values of the pipeline to out, reserving once if the count is known.
+     *
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    template <typename Out>
+    void collect_into(Out& out) const {
+        if constexpr (Derived::exact_size) {
+            out.reserve(out.length() + self().size_bound());
+        }
+        self().run([&](auto&& value) {
+            out.add(std::forward<decltype(value)>(value));
+            return true;
+        });
+    }
+
+    /*!
+     * @brief Evaluates the pipeline into a new List.
+     *
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    template <typename D = Derived>
+    ::List<typename D::value_type> collect() const {
+        ::List<typename D::value_type> out;
+        collect_into(out);
+        return out;
+    }
+
+    /*!
+     * @brief Evaluates the pipeline into a new List using the given allocator.
+     *
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    template <typename Allocator>
+    ::List<typename Allocator::value_type, Allocator> collect(const Allocator& alloc) const {
+        ::List<typename Allocator::value_type, Allocator> out(alloc);
+        collect_into(out);
+        return out;
+    }
+};
+
+/*!
+ * @brief First stage: the elements of a contiguous list, by const reference.
+ */
+template <typename T>
+class Source : public Stage<Source<T>> {
+    ListView<const T> items; ///< The source elements
+
+public:
+    using value_type = T;
+    static constexpr bool exact_size = true;
+
+    explicit Source(ListView<const T> items) : items(items) {}
+
+    template <typename Sink>
+    bool run(Sink&& sink) const {
+        for (const T& value : items) {
+            if (!sink(value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t size_bound() const {
+        return items.length();
+    }
+};
+
+/*!
+ * @brief Passes on the values for which pred(value) is true.
+ */
+template <typename Inner, typename Pred>
+class Filtered : public Stage<Filtered<Inner, Pred>> {
+    Inner inner; ///< The previous stage
+    Pred pred;   ///< The predicate
+
+public:
+    using value_type = typename Inner::value_type;
+    static constexpr bool exact_size = false;
+
+    Filtered(Inner inner, Pred pred) : inner(std::move(inner)), pred(std::move(pred)) {}
+
+    template <typename Sink>
+    bool run(Sink&& sink) const {
+        return inner.run([&](auto&& value) {
+            return pred(value) ? sink(std::forward<decltype(value)>(value)) : true;
+        });
+    }
+
+    size_t size_bound() const {
+        return inner.size_bound();
+    }
+};
+
+/*!
+ * @brief Passes on fn(value) for every value.
+ */
+template <typename Inner, typename Fn>
+class Mapped : public Stage<Mapped<Inner, Fn>> {
+    Inner inner; ///< The previous stage
+    Fn fn;       ///< The transformation
+
+public:
+    using value_type = std::decay_t<std::invoke_result_t<const Fn&, const typename Inner::value_type&>>;
+    static constexpr bool exact_size = Inner::exact_size;
+
+    Mapped(Inner inner, Fn fn) : inner(std::move(inner)), fn(std::move(fn)) {}
+
+    template <typename Sink>
+    bool run(Sink&& sink) const {
+        return inner.run([&](auto&& value) { return sink(fn(std::forward<decltype(value)>(value))); });
+    }
+
+    size_t size_bound() const {
+        return inner.size_bound();
+    }
+};
+
+/*!
+ * @brief Passes on at most the first n values, then stops the whole pipeline.
+ */
+template <typename Inner>
+class Taken : public Stage<Taken<Inner>> {
+    Inner inner; ///< The previous stage
+    size_t n;    ///< Maximum number of values
+
+public:
+    using value_type = typename Inner::value_type;
+    static constexpr bool exact_size = Inner::exact_size;
+
+    Taken(Inner inner, size_t n) : inner(std::move(inner)), n(n) {}
+
+    template <typename Sink>
+    bool run(Sink&& sink) const {
+        if (n == 0) {
+            return true;
+        }
+        size_t seen = 0;
+        bool sink_stopped = false;
+        inner.run([&](auto&& value) {
+            if (!sink(std::forward<decltype(value)>(value))) {
+                sink_stopped = true;
+                return false;
+            }
+            return ++seen < n;
+        });
+        return !sink_stopped;
+    }
+
+    size_t size_bound() const {
+        size_t bound = inner.size_bound();
+        return bound < n ? bound : n;
+    }
+};
+
+template <typename Pred>
+struct filter_adaptor {
+    Pred pred;
+};
+
+template <typename Fn>
+struct map_adaptor {
+    Fn fn;
+};
+
+struct take_adaptor {
+    size_t n;
+};
+
+struct collect_adaptor {};
+
+/*!
+ * @brief Keeps the values for which pred(value) is true.
+ */
+template <typename Pred>
+filter_adaptor<std::decay_t<Pred>> filter(Pred&& pred) {
+    return {std::forward<Pred>(pred)};
+}
+
+/*!
+ * @brief Replaces every value by fn(value).
+ */
+template <typename Fn>
+map_adaptor<std::decay_t<Fn>> map(Fn&& fn) {
+    return {std::forward<Fn>(fn)};
+}
+
+/*!
+ * @brief Keeps the first n values and ends the pass over the source after them.
+ */
+inline take_adaptor take(size_t n) {
+    return {n};
+}
+
+/*!
+ * @brief Terminal step evaluating the pipeline into a List.
+ */
+inline collect_adaptor collect() {
+    return {};
+}
+
+/*!
+ * @brief Starts a pipeline on anything with data() and length() (List, ListView, SortedList...).
+ */
+template <typename C, typename = std::enable_if_t<detail::is_list_like<C>::value && !detail::is_stage<C>::value>>
+Source<detail::element_of<C>> from(const C& list) {
+    return Source<detail::element_of<C>>(ListView<const detail::element_of<C>>(list.data(), list.length()));
+}
+
+template <typename S, typename Pred, typename = std::enable_if_t<detail::is_stage<S>::value>>
+Filtered<S, Pred> operator|(S stage, filter_adaptor<Pred> adaptor) {
+    return Filtered<S, Pred>(std::move(stage), std::move(adaptor.pred));
+}
+
+template <typename S, typename Fn, typename = std::enable_if_t<detail::is_stage<S>::value>>
+Mapped<S, Fn> operator|(S stage, map_adaptor<Fn> adaptor) {
+    return Mapped<S, Fn>(std::move(stage), std::move(adaptor.fn));
+}
+
+template <typename S, typename = std::enable_if_t<detail::is_stage<S>::value>>
+Taken<S> operator|(S stage, take_adaptor adaptor) {
+    return Taken<S>(std::move(stage), adaptor.n);
+}
+
+template <typename S, typename = std::enable_if_t<detail::is_stage<S>::value>>
+auto operator|(const S& stage, collect_adaptor) {
+    return stage.collect();
+}
+
+template <typename C, typename Adaptor,
+          typename = std::enable_if_t<detail::is_list_like<C>::value && !detail::is_stage<C>::value>>
+auto operator|(const C& list, Adaptor adaptor) -> decltype(from(list) | std::move(adaptor)) {
+    return from(list) | std::move(adaptor);
+}
+
+/*! @} */ // End of Pipeline group
+
+} // namespace list_pipeline
+
+#endif // LIST_PIPELINE_HPP
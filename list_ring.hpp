@@ -0,0 +1,502 @@
+/*!
+ * @file list_ring.hpp
+ * @brief Circular-buffer list with O(1) insertion and removal at both ends
+ */
+
+#ifndef LIST_RING_HPP
+#define LIST_RING_HPP
+
+#include "list.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*!
+ * @brief A double-ended list stored as a ring inside one contiguous buffer.
+ *
+ * The elements occupy length() consecutive slots starting at a moving head index and wrap
+ * around the end of the buffer, so push_front, pop_front, push_back and pop_back never shift
+ * other elements. When the ring is full it grows through the same Growth policies as List;
+ * the elements are then relocated into the new buffer unwrapped, starting at slot 0.
+ *
+ * @tparam T The element type.
+ * @tparam Allocator Allocator used for the buffer and element construction.
+ * @tparam Growth Policy picking the new capacity when the ring is full (see Growth group).
+ */
+template <typename T, typename Allocator = std::allocator<T>, typename Growth = GrowthDouble>
+class RingList {
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+private:
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same_v<typename alloc_traits::value_type, T>,
+                  "Allocator::value_type must be the list's element type");
+    static_assert(std::is_same_v<typename alloc_traits::pointer, T*>,
+                  "RingList requires an allocator that returns raw pointers");
+
+    T* elements;         ///< Raw buffer; only the count slots starting at head are constructed
+    size_t head;         ///< Slot of the first element
+    size_t count;        ///< The current number of elements stored
+    size_t capacity;     ///< The number of slots in the buffer
+    Allocator allocator; ///< Source of the buffer
+
+    /*!
+     * @brief Maps a logical position to its buffer slot.
+     *
+     * @param index A position in [0, capacity).
+     */
+    size_t slot(size_t index) const {
+        size_t position = head + index;
+        return (position >= capacity) ? position - capacity : position;
+    }
+
+    /*!
+     * @brief Gets the slot just before head, where push_front builds its element.
+     */
+    size_t slot_before_head() const {
+        return (head == 0) ? capacity - 1 : head - 1;
+    }
+
+    /*!
+     * @brief Relocates the elements, in order, into the raw storage at dst.
+     *
+     * The two wrapped segments are relocated with memcpy for trivially relocatable types.
+     * Otherwise every element is move-constructed (copy-constructed if its move may throw)
+     * and the sources are destroyed only once all destinations are built.
+     *
+     * @param dst Uninitialized storage for count elements.
+     */
+    void relocate_into(T* dst) {
+        size_t first = std::min(count, capacity - head);
+        if constexpr (is_trivially_relocatable<T>::value) {
+            if (count > 0) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(elements + head), first * sizeof(T));
+                std::memcpy(static_cast<void*>(dst + first), static_cast<const void*>(elements),
+                            (count - first) * sizeof(T));
+            }
+        } else {
+            size_t built = 0;
+            try {
+                for (; built < count; ++built) {
+                    alloc_traits::construct(allocator, dst + built, std::move_if_noexcept(elements[slot(built)]));
+                }
+            } catch (...) {
+                for (size_t i = 0; i < built; ++i) {
+                    alloc_traits::destroy(allocator, dst + i);
+                }
+                throw;
+            }
+            for (size_t i = 0; i < count; ++i) {
+                alloc_traits::destroy(allocator, elements + slot(i));
+            }
+        }
+    }
+
+    /*!
+     * @brief Moves the elements into a new buffer of new_capacity slots, unwrapped.
+     *
+     * @param new_capacity The new number of slots (must be >= count).
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void resize(size_t new_capacity) {
+        T* new_elements = nullptr;
+        try {
+            new_elements = alloc_traits::allocate(allocator, new_capacity);
+        } catch (const std::bad_alloc&) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+
+        try {
+            relocate_into(new_elements);
+        } catch (...) {
+            alloc_traits::deallocate(allocator, new_elements, new_capacity);
+            throw;
+        }
+
+        if (elements != nullptr) {
+            alloc_traits::deallocate(allocator, elements, capacity);
+        }
+        elements = new_elements;
+        capacity = new_capacity;
+        head = 0;
+    }
+
+    /*!
+     * @brief Grows the full ring and constructs one new element at its front or back.
+     *
+     * The new element is built in the new buffer before the old elements are relocated,
+     * so arguments that refer to elements of this list stay valid.
+     *
+     * @param at_front true to add the element before the first one, false to add it last.
+     * @param args Constructor arguments for the new element.
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    template <typename... Args>
+    void grow_and_emplace(bool at_front, Args&&... args) {
+        size_t new_capacity = Growth::grow(capacity, count + 1, sizeof(T));
+        T* new_elements = nullptr;
+        try {
+            new_elements = alloc_traits::allocate(allocator, new_capacity);
+        } catch (const std::bad_alloc&) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+
+        // Front insertions land in the last slot, so the old elements can start at slot 0
+        size_t new_slot = at_front ? new_capacity - 1 : count;
+        try {
+            alloc_traits::construct(allocator, new_elements + new_slot, std::forward<Args>(args)...);
+        } catch (...) {
+            alloc_traits::deallocate(allocator, new_elements, new_capacity);
+            throw;
+        }
+
+        try {
+            relocate_into(new_elements);
+        } catch (...) {
+            alloc_traits::destroy(allocator, new_elements + new_slot);
+            alloc_traits::deallocate(allocator, new_elements, new_capacity);
+            throw;
+        }
+
+        if (elements != nullptr) {
+            alloc_traits::deallocate(allocator, elements, capacity);
+        }
+        elements = new_elements;
+        capacity = new_capacity;
+        head = at_front ? new_slot : 0;
+        count++;
+    }
+
+    /*!
+     * @brief Destroys all elements and frees the buffer.
+     */
+    void release_storage() {
+        clear();
+        if (elements != nullptr) {
+            alloc_traits::deallocate(allocator, elements, capacity);
+        }
+        elements = nullptr;
+        capacity = 0;
+    }
+
+public:
+    /*!
+     * @defgroup RingInitialization Initialization and Destruction Functions
+     * @{
+     */
+
+    /*!
+     * @brief Default constructor that creates an empty ring with zero capacity.
+     */
+    RingList() : elements(nullptr), head(0), count(0), capacity(0), allocator() {}
+
+    /*!
+     * @brief Creates an empty ring with zero capacity that will allocate from alloc.
+     *
+     * @param alloc The allocator to copy into the ring.
+     */
+    explicit RingList(const Allocator& alloc) : elements(nullptr), head(0), count(0), capacity(0), allocator(alloc) {}
+
+    /*!
+     * @brief Creates an empty ring with room for capacity elements.
+     *
+     * @param capacity The initial number of slots. Must be > 0.
+     * @param alloc The allocator to copy into the ring.
+     * @throw std::invalid_argument if capacity is 0
+     * @throw std::bad_alloc if memory allocation fails
+     */
+    explicit RingList(size_t capacity, const Allocator& alloc = Allocator())
+        : head(0), count(0), capacity(capacity), allocator(alloc) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Capacity must be greater than 0");
+        }
+
+        elements = alloc_traits::allocate(allocator, capacity);
+    }
+
+    /*!
+     * @brief Destroys the elements and frees the buffer.
+     */
+    ~RingList() {
+        release_storage();
+    }
+
+    RingList(const RingList&) = delete;
+    RingList& operator=(const RingList&) = delete;
+
+    /*!
+     * @brief Move constructor; takes over other's buffer and leaves it empty.
+     */
+    RingList(RingList&& other) noexcept
+        : elements(other.elements),
+          head(other.head),
+          count(other.count),
+          capacity(other.capacity),
+          allocator(std::move(other.allocator)) {
+        other.elements = nullptr;
+        other.head = 0;
+        other.count = 0;
+        other.capacity = 0;
+    }
+
+    /*!
+     * @brief Move assignment operator; takes over other's buffer and leaves it empty.
+     *
+     * Requires an allocator that propagates on move assignment or always compares equal.
+     */
+    RingList& operator=(RingList&& other) noexcept {
+        static_assert(alloc_traits::propagate_on_container_move_assignment::value ||
+                          alloc_traits::is_always_equal::value,
+                      "RingList move assignment needs a propagating or always-equal allocator");
+        if (this != &other) {
+            release_storage();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                allocator = std::move(other.allocator);
+            }
+            elements = other.elements;
+            head = other.head;
+            count = other.count;
+            capacity = other.capacity;
+            other.elements = nullptr;
+            other.head = 0;
+            other.count = 0;
+            other.capacity = 0;
+        }
+        return *this;
+    }
+
+    /*! @} */ // End of RingInitialization group
+
+    /*!
+     * @defgroup RingInformation Basic Information and Access
+     * @{
+     */
+
+    /*!
+     * @brief Gets the current number of elements in the ring.
+     */
+    size_t length() const {
+        return count;
+    }
+
+    /*!
+     * @brief Gets the current number of slots in the buffer.
+     */
+    size_t get_capacity() const {
+        return capacity;
+    }
+
+    /*!
+     * @brief Checks if the ring contains no elements.
+     */
+    bool is_empty() const {
+        return count == 0;
+    }
+
+    /*!
+     * @brief Gets a reference to the element at the specified position, with bounds checking.
+     *
+     * Position 0 is the front of the ring.
+     *
+     * @param index The zero-based position of the element.
+     * @return A reference to the element.
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    T& at(size_t index) {
+        list_detail::check_index(index < count);
+        return elements[slot(index)];
+    }
+
+    /*!
+     * @brief Gets a const reference to the element at the specified position, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    const T& at(size_t index) const {
+        list_detail::check_index(index < count);
+        return elements[slot(index)];
+    }
+
+    /*!
+     * @brief Gets a reference to the element at the specified position (unchecked).
+     */
+    T& operator[](size_t index) {
+        list_detail::debug_check_index(index < count);
+        return elements[slot(index)];
+    }
+
+    /*!
+     * @brief Gets a const reference to the element at the specified position (unchecked).
+     */
+    const T& operator[](size_t index) const {
+        list_detail::debug_check_index(index < count);
+        return elements[slot(index)];
+    }
+
+    /*!
+     * @brief Gets a reference to the first element.
+     *
+     * @throw std::out_of_range if the ring is empty
+     */
+    T& front() {
+        return at(0);
+    }
+
+    /*!
+     * @brief Gets a reference to the last element.
+     *
+     * @throw std::out_of_range if the ring is empty
+     */
+    T& back() {
+        list_detail::check_index(count > 0);
+        return elements[slot(count - 1)];
+    }
+
+    /*! @} */ // End of RingInformation group
+
+    /*!
+     * @defgroup RingManipulation Element Manipulation Functions
+     * @{
+     */
+
+    /*!
+     * @brief Constructs an element in place after the last one in O(1) amortized.
+     *
+     * @param args Constructor arguments for the new element.
+     * @return A reference to the new element.
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (count == capacity) {
+            grow_and_emplace(false, std::forward<Args>(args)...);
+        } else {
+            alloc_traits::construct(allocator, elements + slot(count), std::forward<Args>(args)...);
+            count++;
+        }
+        return elements[slot(count - 1)];
+    }
+
+    /*!
+     * @brief Constructs an element in place before the first one in O(1) amortized.
+     *
+     * @param args Constructor arguments for the new element.
+     * @return A reference to the new element.
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    template <typename... Args>
+    T& emplace_front(Args&&... args) {
+        if (count == capacity) {
+            grow_and_emplace(true, std::forward<Args>(args)...);
+        } else {
+            size_t new_head = slot_before_head();
+            alloc_traits::construct(allocator, elements + new_head, std::forward<Args>(args)...);
+            head = new_head;
+            count++;
+        }
+        return elements[head];
+    }
+
+    /*!
+     * @brief Adds a copy of element after the last one.
+     *
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void push_back(const T& element) {
+        emplace_back(element);
+    }
+
+    /*!
+     * @brief Moves element in after the last one.
+     *
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void push_back(T&& element) {
+        emplace_back(std::move(element));
+    }
+
+    /*!
+     * @brief Adds a copy of element before the first one.
+     *
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void push_front(const T& element) {
+        emplace_front(element);
+    }
+
+    /*!
+     * @brief Moves element in before the first one.
+     *
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void push_front(T&& element) {
+        emplace_front(std::move(element));
+    }
+
+    /*!
+     * @brief Removes the first element in O(1) and returns it.
+     *
+     * @return The removed element.
+     * @throw std::out_of_range if the ring is empty
+     */
+    T pop_front() {
+        list_detail::check_index(count > 0);
+        T value = std::move(elements[head]);
+        alloc_traits::destroy(allocator, elements + head);
+        head = slot(1);
+        count--;
+        return value;
+    }
+
+    /*!
+     * @brief Removes the last element in O(1) and returns it.
+     *
+     * @return The removed element.
+     * @throw std::out_of_range if the ring is empty
+     */
+    T pop_back() {
+        list_detail::check_index(count > 0);
+        size_t last = slot(count - 1);
+        T value = std::move(elements[last]);
+        alloc_traits::destroy(allocator, elements + last);
+        count--;
+        return value;
+    }
+
+    /*!
+     * @brief Removes all elements, keeping the buffer.
+     */
+    void clear() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < count; ++i) {
+                alloc_traits::destroy(allocator, elements + slot(i));
+            }
+        }
+        head = 0;
+        count = 0;
+    }
+
+    /*!
+     * @brief Grows the buffer to exactly new_capacity slots if it is smaller.
+     *
+     * @param new_capacity The minimum number of slots to make room for.
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity) {
+            resize(new_capacity);
+        }
+    }
+
+    /*! @} */ // End of RingManipulation group
+};
+
+#endif // LIST_RING_HPP
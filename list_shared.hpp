@@ -0,0 +1,327 @@
+/*!
+ * @file list_shared.hpp
+ * @brief Copy-on-write list shared between many readers and occasional writers
+ */
+
+#ifndef LIST_SHARED_HPP
+#define LIST_SHARED_HPP
+
+#include "list.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+template <typename T, typename Allocator>
+class SharedList;
+
+namespace list_detail {
+
+/*!
+ * @brief One published, never again modified version of a SharedList.
+ */
+template <typename T, typename Allocator>
+struct SharedListVersion {
+    List<T, Allocator> items; ///< The elements of this version
+    uint64_t number;          ///< Incremented by every publish
+
+    SharedListVersion(const Allocator& alloc, uint64_t number) : items(alloc), number(number) {}
+};
+
+} // namespace list_detail
+
+/*!
+ * @brief An immutable, reference-counted view of one version of a SharedList.
+ *
+ * Taking a snapshot costs one atomic reference-count increment; after that every read goes
+ * straight to the buffer, and the buffer stays alive (and unchanged) for as long as any
+ * snapshot of it exists, no matter what writers publish in the meantime. A default-constructed
+ * snapshot is empty.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class ListSnapshot {
+private:
+    using Version = list_detail::SharedListVersion<T, Allocator>;
+
+    std::shared_ptr<const Version> version; ///< Keeps the buffer alive
+    ListView<const T> items;                ///< The elements of that version
+
+    friend class SharedList<T, Allocator>;
+
+    explicit ListSnapshot(std::shared_ptr<const Version> version)
+        : version(std::move(version)), items(this->version->items.view()) {}
+
+public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    ListSnapshot() = default;
+
+    /*!
+     * @brief Gets the version number of the snapshot (0 for a default-constructed one).
+     */
+    uint64_t version_number() const {
+        return version ? version->number : 0;
+    }
+
+    size_t length() const {
+        return items.length();
+    }
+
+    bool is_empty() const {
+        return items.is_empty();
+    }
+
+    /*!
+     * @brief Gets the element at the specified index, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    const T& at(size_t index) const {
+        return items.at(index);
+    }
+
+    const T& operator[](size_t index) const {
+        return items[index];
+    }
+
+    const T* data() const {
+        return items.data();
+    }
+
+    const_iterator begin() const {
+        return items.begin();
+    }
+
+    const_iterator end() const {
+        return items.end();
+    }
+
+    long index_of(const T& value) const {
+        return items.index_of(value);
+    }
+
+    bool contains(const T& value) const {
+        return items.contains(value);
+    }
+
+    /*!
+     * @brief Gets a view of the elements; valid while this snapshot is alive.
+     */
+    ListView<const T> view() const {
+        return items;
+    }
+};
+
+/*!
+ * @brief A list for read-mostly data shared across threads, updated by copy-on-write.
+ *
+ * Readers call snapshot() and read the returned ListSnapshot without any locking. Writers
+ * are serialized by a mutex; each write copies the current version, applies the change and
+ * publishes the copy with a single atomic store, so readers never observe a half-applied
+ * write (RCU style). Old versions are freed when their last snapshot goes away.
+ *
+ * The published version may be held by any number of readers, so every write does clone it;
+ * use update() to apply a batch of changes for the price of one clone. Readers that keep a
+ * snapshot around can call refresh(), which compares version numbers with a single atomic
+ * load and only takes a new snapshot when a writer has published since.
+ *
+ * With C++20's std::atomic<std::shared_ptr> the current version is stored in one; in C++17
+ * it goes through the std::atomic_load / std::atomic_store overloads for shared_ptr.
+ *
+ * @tparam T The element type. Must be copy-constructible.
+ * @tparam Allocator Allocator used for each version's buffer.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class SharedList {
+private:
+    using Version = list_detail::SharedListVersion<T, Allocator>;
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<std::shared_ptr<const Version>> current; ///< The published version
+#else
+    std::shared_ptr<const Version> current; ///< The published version (accessed atomically)
+#endif
+    std::atomic<uint64_t> published; ///< Number of the published version, for refresh()
+    std::mutex write_lock;           ///< Serializes writers
+    Allocator allocator;             ///< Passed on to every version
+
+    std::shared_ptr<const Version> load_current() const {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return current.load(std::memory_order_acquire);
+#else
+        return std::atomic_load_explicit(&current, std::memory_order_acquire);
+#endif
+    }
+
+    void store_current(std::shared_ptr<const Version> next) {
+        uint64_t number = next->number;
+#if defined(__cpp_lib_atomic_shared_ptr)
+        current.store(std::move(next), std::memory_order_release);
+#else
+        std::atomic_store_explicit(&current, std::move(next), std::memory_order_release);
+#endif
+        published.store(number, std::memory_order_release);
+    }
+
+    /*!
+     * @brief Clones the current version with room for extra more elements, lets fn edit the
+     * clone and publishes it. Must be called with write_lock held.
+     */
+    template <typename Fn>
+    void publish_modified(size_t extra, Fn&& fn) {
+        std::shared_ptr<const Version> base = load_current();
+        auto next = std::make_shared<Version>(allocator, base->number + 1);
+        next->items.reserve(base->items.length() + extra);
+        next->items.append(base->items.data(), base->items.length());
+        fn(next->items);
+        store_current(std::move(next));
+    }
+
+public:
+    using value_type = T;
+    using snapshot_type = ListSnapshot<T, Allocator>;
+
+    /*!
+     * @defgroup SharedInitialization Initialization
+     * @{
+     */
+
+    /*!
+     * @brief Creates an empty shared list (version 1).
+     *
+     * @param alloc The allocator each version's buffer is taken from.
+     */
+    explicit SharedList(const Allocator& alloc = Allocator())
+        : current(std::make_shared<const Version>(alloc, 1)), published(1), allocator(alloc) {}
+
+    /*!
+     * @brief Creates a shared list whose first version holds the elements of source, leaving
+     * source empty.
+     *
+     * A List with the default growth policy and statistics hands over its buffer; any other
+     * List has its elements moved into a new one.
+     */
+    template <typename G, typename S>
+    explicit SharedList(List<T, Allocator, G, S>&& source)
+        : current(nullptr), published(1), allocator(source.get_allocator()) {
+        auto first = std::make_shared<Version>(allocator, 1);
+        if constexpr (std::is_same_v<List<T, Allocator, G, S>, List<T, Allocator>>) {
+            first->items = std::move(source);
+        } else {
+            first->items.reserve(source.length());
+            for (T& element : source) {
+                first->items.add(std::move(element));
+            }
+            source.clear();
+        }
+        store_current(std::move(first));
+    }
+
+    SharedList(const SharedList&) = delete;
+    SharedList& operator=(const SharedList&) = delete;
+
+    /*! @} */ // End of SharedInitialization group
+
+    /*!
+     * @defgroup SharedReading Reading
+     * @{
+     */
+
+    /*!
+     * @brief Takes a snapshot of the current version. Never blocks on writers.
+     */
+    snapshot_type snapshot() const {
+        return snapshot_type(load_current());
+    }
+
+    /*!
+     * @brief Gets the number of the most recently published version.
+     */
+    uint64_t version_number() const {
+        return published.load(std::memory_order_acquire);
+    }
+
+    /*!
+     * @brief Replaces snapshot with the current version if a newer one has been published.
+     *
+     * @return true if the snapshot was replaced.
+     */
+    bool refresh(snapshot_type& snapshot) const {
+        if (snapshot.version_number() == version_number()) {
+            return false;
+        }
+        snapshot = this->snapshot();
+        return true;
+    }
+
+    /*!
+     * @brief Gets the length of the current version.
+     */
+    size_t length() const {
+        return load_current()->items.length();
+    }
+
+    /*! @} */ // End of SharedReading group
+
+    /*!
+     * @defgroup SharedWriting Writing
+     * @{
+     */
+
+    /*!
+     * @brief Publishes a version with element added at the end.
+     */
+    void add(const T& element) {
+        std::lock_guard<std::mutex> guard(write_lock);
+        publish_modified(1, [&](List<T, Allocator>& items) { items.add(element); });
+    }
+
+    /*!
+     * @brief Publishes a version with the element at index replaced by value.
+     *
+     * @throw std::out_of_range if the index is out of bounds (nothing is published)
+     */
+    void set_element(size_t index, const T& value) {
+        std::lock_guard<std::mutex> guard(write_lock);
+        publish_modified(0, [&](List<T, Allocator>& items) { items.set_element(index, value); });
+    }
+
+    /*!
+     * @brief Publishes a version without the element at index.
+     *
+     * @throw std::out_of_range if the index is out of bounds (nothing is published)
+     */
+    void remove_at(size_t index) {
+        std::lock_guard<std::mutex> guard(write_lock);
+        publish_modified(0, [&](List<T, Allocator>& items) { items.remove_at(index); });
+    }
+
+    /*!
+     * @brief Publishes an empty version.
+     */
+    void clear() {
+        std::lock_guard<std::mutex> guard(write_lock);
+        store_current(std::make_shared<const Version>(allocator, load_current()->number + 1));
+    }
+
+    /*!
+     * @brief Applies any number of edits to a private copy and publishes them as one version.
+     *
+     * If fn throws, nothing is published.
+     *
+     * @param fn Called as fn(List<T, Allocator>&) with a copy of the current elements.
+     */
+    template <typename Fn>
+    void update(Fn&& fn) {
+        std::lock_guard<std::mutex> guard(write_lock);
+        publish_modified(0, std::forward<Fn>(fn));
+    }
+
+    /*! @} */ // End of SharedWriting group
+};
+
+#endif // LIST_SHARED_HPP
@@ -0,0 +1,602 @@
+/*!
+ * @file list_simd.hpp
+ * @brief Vectorized equality search kernels used by List's search functions
+ *
+ * Integer, enum, pointer, float and double elements are compared 16 to 64 bytes at a time
+ * with SSE2, AVX2 or AVX-512 (picked at runtime on x86) or NEON (on AArch64). Every other
+ * element type, and every platform without a kernel, uses a plain operator== loop.
+ */
+
+#ifndef LIST_SIMD_HPP
+#define LIST_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define LIST_SIMD_X86 1
+#include <immintrin.h>
+#define LIST_TARGET_AVX2 __attribute__((target("avx2")))
+#define LIST_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define LIST_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace list_simd {
+
+/*!
+ * @brief Instruction sets the search kernels can run on.
+ */
+enum class Isa {
+    scalar, ///< Plain operator== loop
+    sse2,   ///< 16-byte vectors (x86 baseline)
+    avx2,   ///< 32-byte vectors
+    avx512, ///< 64-byte vectors (needs AVX-512F and AVX-512BW)
+    neon    ///< 16-byte vectors (AArch64)
+};
+
+/*!
+ * @brief Tells whether T can be compared with vector equality instructions.
+ *
+ * True for integral, enum and pointer types of 1, 2, 4 or 8 bytes (equality is bitwise)
+ * and for IEEE float and double (compared with IEEE semantics, exactly like operator==).
+ *
+ * @tparam T The element type.
+ */
+template <typename T>
+struct is_simd_searchable
+    : std::bool_constant<((std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) &&
+                          (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)) ||
+                         (std::is_same_v<T, float> && std::numeric_limits<float>::is_iec559) ||
+                         (std::is_same_v<T, double> && std::numeric_limits<double>::is_iec559)> {};
+
+/*!
+ * @brief Maximum number of keys compared per pass in find_first_of.
+ *
+ * Larger key sets are searched in groups of this size.
+ */
+constexpr size_t max_keys_per_pass = 8;
+
+/*!
+ * @brief Detects the best instruction set supported by the running CPU.
+ *
+ * @return The widest available Isa.
+ */
+inline Isa detect_isa() {
+#if defined(LIST_SIMD_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+        return Isa::avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return Isa::avx2;
+    }
+    return Isa::sse2;
+#elif defined(LIST_SIMD_NEON)
+    return Isa::neon;
+#else
+    return Isa::scalar;
+#endif
+}
+
+namespace detail {
+
+inline Isa& selected_isa() {
+    static Isa isa = detect_isa();
+    return isa;
+}
+
+} // namespace detail
+
+/*!
+ * @brief Gets the instruction set the kernels currently dispatch to.
+ *
+ * @return The active Isa (detected on first use).
+ */
+inline Isa active_isa() {
+    return detail::selected_isa();
+}
+
+/*!
+ * @brief Restricts dispatch to the given instruction set (for benchmarks and tests).
+ *
+ * Requests for an instruction set the CPU does not support fall back to the detected one.
+ * Not thread-safe with respect to concurrent searches.
+ *
+ * @param isa The instruction set to use.
+ * @return The instruction set actually selected.
+ */
+inline Isa set_active_isa(Isa isa) {
+    Isa detected = detect_isa();
+    bool supported = isa == Isa::scalar || isa == detected ||
+                     (detected == Isa::avx512 && (isa == Isa::avx2 || isa == Isa::sse2)) ||
+                     (detected == Isa::avx2 && isa == Isa::sse2);
+    detail::selected_isa() = supported ? isa : detected;
+    return detail::selected_isa();
+}
+
+namespace detail {
+
+template <typename T>
+long find_first_of_scalar(const T* data, size_t n, const T* keys, size_t key_count) {
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t k = 0; k < key_count; ++k) {
+            if (data[i] == keys[k]) {
+                return static_cast<long>(i);
+            }
+        }
+    }
+    return -1;
+}
+
+template <typename T>
+size_t count_scalar(const T* data, size_t n, const T& value) {
+    size_t hits = 0;
+    for (size_t i = 0; i < n; ++i) {
+        hits += (data[i] == value) ? 1 : 0;
+    }
+    return hits;
+}
+
+/*!
+ * @brief Reinterprets an element as the unsigned integer of the same width.
+ */
+template <typename T>
+auto as_bits(const T& value) {
+    using Bits = std::conditional_t<sizeof(T) == 1, uint8_t,
+                 std::conditional_t<sizeof(T) == 2, uint16_t,
+                 std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+#if defined(LIST_SIMD_X86)
+
+// ---- SSE2: 16-byte vectors, one movemask bit per byte ----
+
+template <typename T>
+inline __m128i sse2_broadcast(const T& value) {
+    auto bits = as_bits(value);
+    if constexpr (sizeof(T) == 1) {
+        return _mm_set1_epi8(static_cast<char>(bits));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm_set1_epi16(static_cast<short>(bits));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm_set1_epi32(static_cast<int>(bits));
+    } else {
+        return _mm_set1_epi64x(static_cast<long long>(bits));
+    }
+}
+
+template <typename T>
+inline __m128i sse2_equal(__m128i a, __m128i b) {
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm_cmpeq_epi8(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm_cmpeq_epi16(a, b);
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm_cmpeq_epi32(a, b);
+    } else {
+        // SSE2 has no 64-bit compare: both 32-bit halves must match
+        __m128i halves = _mm_cmpeq_epi32(a, b);
+        return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+}
+
+template <typename T>
+inline __m128i sse2_hits(const T* at, const __m128i* needles, size_t key_count) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(at));
+    __m128i hits = sse2_equal<T>(block, needles[0]);
+    for (size_t k = 1; k < key_count; ++k) {
+        hits = _mm_or_si128(hits, sse2_equal<T>(block, needles[k]));
+    }
+    return hits;
+}
+
+template <typename T>
+long find_first_of_sse2(const T* data, size_t n, const T* keys, size_t key_count) {
+    constexpr size_t lanes = 16 / sizeof(T);
+    __m128i needles[max_keys_per_pass];
+    for (size_t k = 0; k < key_count; ++k) {
+        needles[k] = sse2_broadcast(keys[k]);
+    }
+
+    size_t i = 0;
+    for (; i + 4 * lanes <= n; i += 4 * lanes) {
+        __m128i h0 = sse2_hits(data + i, needles, key_count);
+        __m128i h1 = sse2_hits(data + i + lanes, needles, key_count);
+        __m128i h2 = sse2_hits(data + i + 2 * lanes, needles, key_count);
+        __m128i h3 = sse2_hits(data + i + 3 * lanes, needles, key_count);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(h0, h1), _mm_or_si128(h2, h3))) != 0) {
+            break; // The single-vector loop below locates the exact lane
+        }
+    }
+    for (; i + lanes <= n; i += lanes) {
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(sse2_hits(data + i, needles, key_count)));
+        if (mask != 0) {
+            return static_cast<long>(i + static_cast<size_t>(__builtin_ctz(mask)) / sizeof(T));
+        }
+    }
+    long tail = find_first_of_scalar(data + i, n - i, keys, key_count);
+    return tail < 0 ? -1 : static_cast<long>(i) + tail;
+}
+
+template <typename T>
+size_t count_sse2(const T* data, size_t n, const T& value) {
+    constexpr size_t lanes = 16 / sizeof(T);
+    __m128i needle = sse2_broadcast(value);
+    size_t bytes = 0;
+    size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        bytes += static_cast<size_t>(__builtin_popcount(
+            static_cast<unsigned>(_mm_movemask_epi8(sse2_hits(data + i, &needle, 1)))));
+    }
+    return bytes / sizeof(T) + count_scalar(data + i, n - i, value);
+}
+
+// ---- AVX2: 32-byte vectors, one movemask bit per byte ----
+
+template <typename T>
+LIST_TARGET_AVX2 inline __m256i avx2_broadcast(const T& value) {
+    auto bits = as_bits(value);
+    if constexpr (sizeof(T) == 1) {
+        return _mm256_set1_epi8(static_cast<char>(bits));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm256_set1_epi16(static_cast<short>(bits));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm256_set1_epi32(static_cast<int>(bits));
+    } else {
+        return _mm256_set1_epi64x(static_cast<long long>(bits));
+    }
+}
+
+template <typename T>
+LIST_TARGET_AVX2 inline __m256i avx2_equal(__m256i a, __m256i b) {
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm256_cmpeq_epi8(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm256_cmpeq_epi16(a, b);
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm256_cmpeq_epi32(a, b);
+    } else {
+        return _mm256_cmpeq_epi64(a, b);
+    }
+}
+
+template <typename T>
+LIST_TARGET_AVX2 inline __m256i avx2_hits(const T* at, const __m256i* needles, size_t key_count) {
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(at));
+    __m256i hits = avx2_equal<T>(block, needles[0]);
+    for (size_t k = 1; k < key_count; ++k) {
+        hits = _mm256_or_si256(hits, avx2_equal<T>(block, needles[k]));
+    }
+    return hits;
+}
+
+template <typename T>
+LIST_TARGET_AVX2 long find_first_of_avx2(const T* data, size_t n, const T* keys, size_t key_count) {
+    constexpr size_t lanes = 32 / sizeof(T);
+    __m256i needles[max_keys_per_pass];
+    for (size_t k = 0; k < key_count; ++k) {
+        needles[k] = avx2_broadcast(keys[k]);
+    }
+
+    size_t i = 0;
+    for (; i + 4 * lanes <= n; i += 4 * lanes) {
+        __m256i h0 = avx2_hits(data + i, needles, key_count);
+        __m256i h1 = avx2_hits(data + i + lanes, needles, key_count);
+        __m256i h2 = avx2_hits(data + i + 2 * lanes, needles, key_count);
+        __m256i h3 = avx2_hits(data + i + 3 * lanes, needles, key_count);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(h0, h1), _mm256_or_si256(h2, h3));
+        if (!_mm256_testz_si256(any, any)) {
+            break; // The single-vector loop below locates the exact lane
+        }
+    }
+    for (; i + lanes <= n; i += lanes) {
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(avx2_hits(data + i, needles, key_count)));
+        if (mask != 0) {
+            return static_cast<long>(i + static_cast<size_t>(__builtin_ctz(mask)) / sizeof(T));
+        }
+    }
+    long tail = find_first_of_scalar(data + i, n - i, keys, key_count);
+    return tail < 0 ? -1 : static_cast<long>(i) + tail;
+}
+
+template <typename T>
+LIST_TARGET_AVX2 size_t count_avx2(const T* data, size_t n, const T& value) {
+    constexpr size_t lanes = 32 / sizeof(T);
+    __m256i needle = avx2_broadcast(value);
+    size_t bytes = 0;
+    size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        bytes += static_cast<size_t>(__builtin_popcount(
+            static_cast<unsigned>(_mm256_movemask_epi8(avx2_hits(data + i, &needle, 1)))));
+    }
+    return bytes / sizeof(T) + count_scalar(data + i, n - i, value);
+}
+
+// ---- AVX-512: 64-byte vectors, one mask bit per lane ----
+
+template <typename T>
+LIST_TARGET_AVX512 inline __m512i avx512_broadcast(const T& value) {
+    auto bits = as_bits(value);
+    if constexpr (sizeof(T) == 1) {
+        return _mm512_set1_epi8(static_cast<char>(bits));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm512_set1_epi16(static_cast<short>(bits));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm512_set1_epi32(static_cast<int>(bits));
+    } else {
+        return _mm512_set1_epi64(static_cast<long long>(bits));
+    }
+}
+
+template <typename T>
+LIST_TARGET_AVX512 inline uint64_t avx512_equal(__m512i a, __m512i b) {
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm512_cmp_ps_mask(_mm512_castsi512_ps(a), _mm512_castsi512_ps(b), _CMP_EQ_OQ);
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm512_cmp_pd_mask(_mm512_castsi512_pd(a), _mm512_castsi512_pd(b), _CMP_EQ_OQ);
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm512_cmpeq_epi8_mask(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm512_cmpeq_epi16_mask(a, b);
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm512_cmpeq_epi32_mask(a, b);
+    } else {
+        return _mm512_cmpeq_epi64_mask(a, b);
+    }
+}
+
+template <typename T>
+LIST_TARGET_AVX512 inline uint64_t avx512_hits(const T* at, const __m512i* needles, size_t key_count) {
+    __m512i block = _mm512_loadu_si512(static_cast<const void*>(at));
+    uint64_t hits = avx512_equal<T>(block, needles[0]);
+    for (size_t k = 1; k < key_count; ++k) {
+        hits |= avx512_equal<T>(block, needles[k]);
+    }
+    return hits;
+}
+
+template <typename T>
+LIST_TARGET_AVX512 long find_first_of_avx512(const T* data, size_t n, const T* keys, size_t key_count) {
+    constexpr size_t lanes = 64 / sizeof(T);
+    __m512i needles[max_keys_per_pass];
+    for (size_t k = 0; k < key_count; ++k) {
+        needles[k] = avx512_broadcast(keys[k]);
+    }
+
+    size_t i = 0;
+    for (; i + 2 * lanes <= n; i += 2 * lanes) {
+        uint64_t h0 = avx512_hits(data + i, needles, key_count);
+        uint64_t h1 = avx512_hits(data + i + lanes, needles, key_count);
+        if ((h0 | h1) != 0) {
+            size_t lane = (h0 != 0) ? static_cast<size_t>(__builtin_ctzll(h0))
+                                    : lanes + static_cast<size_t>(__builtin_ctzll(h1));
+            return static_cast<long>(i + lane);
+        }
+    }
+    for (; i + lanes <= n; i += lanes) {
+        uint64_t mask = avx512_hits(data + i, needles, key_count);
+        if (mask != 0) {
+            return static_cast<long>(i + static_cast<size_t>(__builtin_ctzll(mask)));
+        }
+    }
+    long tail = find_first_of_scalar(data + i, n - i, keys, key_count);
+    return tail < 0 ? -1 : static_cast<long>(i) + tail;
+}
+
+template <typename T>
+LIST_TARGET_AVX512 size_t count_avx512(const T* data, size_t n, const T& value) {
+    constexpr size_t lanes = 64 / sizeof(T);
+    __m512i needle = avx512_broadcast(value);
+    size_t hits = 0;
+    size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        hits += static_cast<size_t>(__builtin_popcountll(avx512_hits(data + i, &needle, 1)));
+    }
+    return hits + count_scalar(data + i, n - i, value);
+}
+
+#elif defined(LIST_SIMD_NEON)
+
+// ---- NEON: 16-byte vectors, narrowed to a 64-bit mask with 4 bits per byte ----
+
+template <typename T>
+inline uint8x16_t neon_broadcast(const T& value) {
+    auto bits = as_bits(value);
+    if constexpr (sizeof(T) == 1) {
+        return vdupq_n_u8(bits);
+    } else if constexpr (sizeof(T) == 2) {
+        return vreinterpretq_u8_u16(vdupq_n_u16(bits));
+    } else if constexpr (sizeof(T) == 4) {
+        return vreinterpretq_u8_u32(vdupq_n_u32(bits));
+    } else {
+        return vreinterpretq_u8_u64(vdupq_n_u64(bits));
+    }
+}
+
+template <typename T>
+inline uint8x16_t neon_equal(uint8x16_t a, uint8x16_t b) {
+    if constexpr (std::is_same_v<T, float>) {
+        return vreinterpretq_u8_u32(vceqq_f32(vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(b)));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return vreinterpretq_u8_u64(vceqq_f64(vreinterpretq_f64_u8(a), vreinterpretq_f64_u8(b)));
+    } else if constexpr (sizeof(T) == 1) {
+        return vceqq_u8(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+        return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)));
+    } else if constexpr (sizeof(T) == 4) {
+        return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)));
+    } else {
+        return vreinterpretq_u8_u64(vceqq_u64(vreinterpretq_u64_u8(a), vreinterpretq_u64_u8(b)));
+    }
+}
+
+template <typename T>
+inline uint64_t neon_hits(const T* at, const uint8x16_t* needles, size_t key_count) {
+    uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(at));
+    uint8x16_t hits = neon_equal<T>(block, needles[0]);
+    for (size_t k = 1; k < key_count; ++k) {
+        hits = vorrq_u8(hits, neon_equal<T>(block, needles[k]));
+    }
+    uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(hits), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+template <typename T>
+long find_first_of_neon(const T* data, size_t n, const T* keys, size_t key_count) {
+    constexpr size_t lanes = 16 / sizeof(T);
+    uint8x16_t needles[max_keys_per_pass];
+    for (size_t k = 0; k < key_count; ++k) {
+        needles[k] = neon_broadcast(keys[k]);
+    }
+
+    size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        uint64_t mask = neon_hits(data + i, needles, key_count);
+        if (mask != 0) {
+            return static_cast<long>(i + static_cast<size_t>(__builtin_ctzll(mask)) / (4 * sizeof(T)));
+        }
+    }
+    long tail = find_first_of_scalar(data + i, n - i, keys, key_count);
+    return tail < 0 ? -1 : static_cast<long>(i) + tail;
+}
+
+template <typename T>
+size_t count_neon(const T* data, size_t n, const T& value) {
+    constexpr size_t lanes = 16 / sizeof(T);
+    uint8x16_t needle = neon_broadcast(value);
+    size_t nibbles = 0;
+    size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        nibbles += static_cast<size_t>(__builtin_popcountll(neon_hits(data + i, &needle, 1)));
+    }
+    return nibbles / (4 * sizeof(T)) + count_scalar(data + i, n - i, value);
+}
+
+#endif
+
+/*!
+ * @brief Runs one find pass over at most max_keys_per_pass keys on the active instruction set.
+ */
+template <typename T>
+long find_first_of_pass(const T* data, size_t n, const T* keys, size_t key_count) {
+    switch (active_isa()) {
+#if defined(LIST_SIMD_X86)
+    case Isa::avx512:
+        return find_first_of_avx512(data, n, keys, key_count);
+    case Isa::avx2:
+        return find_first_of_avx2(data, n, keys, key_count);
+    case Isa::sse2:
+        return find_first_of_sse2(data, n, keys, key_count);
+#elif defined(LIST_SIMD_NEON)
+    case Isa::neon:
+        return find_first_of_neon(data, n, keys, key_count);
+#endif
+    default:
+        return find_first_of_scalar(data, n, keys, key_count);
+    }
+}
+
+} // namespace detail
+
+/*!
+ * @brief Finds the first element equal to any of the given keys.
+ *
+ * Keys are compared in groups of max_keys_per_pass; each later group only scans the prefix
+ * before the best match found so far.
+ *
+ * @param data The elements to search.
+ * @param n Number of elements.
+ * @param keys The values to look for.
+ * @param key_count Number of keys.
+ * @return The index of the first matching element, or -1 if none matches.
+ */
+template <typename T>
+long find_first_of(const T* data, size_t n, const T* keys, size_t key_count) {
+    if constexpr (!is_simd_searchable<T>::value) {
+        return detail::find_first_of_scalar(data, n, keys, key_count);
+    } else {
+        long best = -1;
+        size_t limit = n;
+        for (size_t k = 0; k < key_count; k += max_keys_per_pass) {
+            size_t group = (key_count - k < max_keys_per_pass) ? key_count - k : max_keys_per_pass;
+            long found = detail::find_first_of_pass(data, limit, keys + k, group);
+            if (found >= 0) {
+                best = found;
+                limit = static_cast<size_t>(found);
+            }
+        }
+        return best;
+    }
+}
+
+/*!
+ * @brief Finds the first element equal to value.
+ *
+ * @param data The elements to search.
+ * @param n Number of elements.
+ * @param value The value to look for.
+ * @return The index of the first matching element, or -1 if none matches.
+ */
+template <typename T>
+long find_first(const T* data, size_t n, const T& value) {
+    if constexpr (!is_simd_searchable<T>::value) {
+        for (size_t i = 0; i < n; ++i) {
+            if (data[i] == value) {
+                return static_cast<long>(i);
+            }
+        }
+        return -1;
+    } else {
+        return detail::find_first_of_pass(data, n, &value, 1);
+    }
+}
+
+/*!
+ * @brief Counts the elements equal to value.
+ *
+ * @param data The elements to search.
+ * @param n Number of elements.
+ * @param value The value to count.
+ * @return The number of matching elements.
+ */
+template <typename T>
+size_t count_equal(const T* data, size_t n, const T& value) {
+    if constexpr (is_simd_searchable<T>::value) {
+        switch (active_isa()) {
+#if defined(LIST_SIMD_X86)
+        case Isa::avx512:
+            return detail::count_avx512(data, n, value);
+        case Isa::avx2:
+            return detail::count_avx2(data, n, value);
+        case Isa::sse2:
+            return detail::count_sse2(data, n, value);
+#elif defined(LIST_SIMD_NEON)
+        case Isa::neon:
+            return detail::count_neon(data, n, value);
+#endif
+        default:
+            break;
+        }
+    }
+    return detail::count_scalar(data, n, value);
+}
+
+} // namespace list_simd
+
+#endif // LIST_SIMD_HPP
@@ -0,0 +1,682 @@
+/*!
+ * @file list_soa.hpp
+ * @brief Structure-of-arrays list: one aligned column per field, with row proxies
+ */
+
+#ifndef LIST_SOA_HPP
+#define LIST_SOA_HPP
+
+#include "list.hpp"
+
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/*!
+ * @brief Contiguous view of one column of a SoAList.
+ *
+ * Valid until the list grows, is moved from or is destroyed.
+ *
+ * @tparam T The field type (const-qualified for a read-only view).
+ */
+template <typename T>
+class SoAColumn {
+private:
+    T* elements;  ///< First element of the column
+    size_t count; ///< Number of rows
+
+public:
+    SoAColumn(T* elements, size_t count) : elements(elements), count(count) {}
+
+    T* data() const {
+        return elements;
+    }
+
+    size_t length() const {
+        return count;
+    }
+
+    T* begin() const {
+        return elements;
+    }
+
+    T* end() const {
+        return elements + count;
+    }
+
+    T& operator[](size_t index) const {
+        return elements[index];
+    }
+};
+
+/*!
+ * @brief A list of records stored field by field, each field in its own aligned column.
+ *
+ * A loop that reads one field streams through one dense column instead of striding over
+ * whole records, so it uses every byte of each cache line it loads and vectorizes like a
+ * loop over a plain array. All columns share one allocation, with each column starting on
+ * a column_alignment boundary, and grow together through the List growth policies.
+ *
+ * Like List, the columns may instead be caller-provided static buffers (init_static), whose
+ * slots are treated as live objects owned by the caller.
+ *
+ * @tparam Growth Policy picking the new capacity when the list is full (see Growth group).
+ * @tparam Fields The field types of one record, in column order.
+ */
+template <typename Growth, typename... Fields>
+class BasicSoAList {
+    static_assert(sizeof...(Fields) > 0, "SoAList needs at least one field");
+
+public:
+    using reference = std::tuple<Fields&...>;             ///< Row proxy: one reference per field
+    using const_reference = std::tuple<const Fields&...>; ///< Read-only row proxy
+
+    /*!
+     * @brief Alignment of every column, in bytes (one cache line, enough for AVX-512 loads).
+     */
+    static constexpr size_t column_alignment = 64;
+
+    /*!
+     * @brief Type of column I.
+     */
+    template <size_t I>
+    using field_type = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+private:
+    using indices = std::index_sequence_for<Fields...>;
+
+    std::tuple<Fields*...> columns; ///< Start of each column
+    void* block;                    ///< The shared allocation (dynamic lists only)
+    size_t count;                   ///< The current number of rows stored
+    size_t capacity;                ///< The number of rows every column has room for
+    bool is_dynamic;                ///< Flag to indicate the columns were allocated by the list
+
+    static size_t align_up(size_t bytes) {
+        return (bytes + column_alignment - 1) & ~(column_alignment - 1);
+    }
+
+    /*!
+     * @brief Total bytes of one block holding new_capacity rows.
+     *
+     * @throw std::bad_alloc if the size does not fit in a size_t
+     */
+    static size_t block_bytes(size_t new_capacity) {
+        constexpr size_t max_bytes = std::numeric_limits<size_t>::max();
+        size_t total = 0;
+        bool fits = true;
+        auto add_column = [&](size_t field_size) {
+            if (!fits || total > max_bytes - (column_alignment - 1)) {
+                fits = false;
+                return;
+            }
+            total = align_up(total);
+            if (new_capacity > (max_bytes - total) / field_size) {
+                fits = false;
+                return;
+            }
+            total += new_capacity * field_size;
+        };
+        (add_column(sizeof(Fields)), ...);
+        if (!fits) {
+            throw std::bad_alloc();
+        }
+        return total;
+    }
+
+    template <typename F>
+    static F* place_column(char* base, size_t& offset, size_t new_capacity) {
+        offset = align_up(offset);
+        F* column = reinterpret_cast<F*>(base + offset);
+        offset += new_capacity * sizeof(F);
+        return column;
+    }
+
+    /*!
+     * @brief Splits a block into the column start pointers.
+     */
+    static std::tuple<Fields*...> carve(void* new_block, size_t new_capacity) {
+        char* base = static_cast<char*>(new_block);
+        size_t offset = 0;
+        return std::tuple<Fields*...>{place_column<Fields>(base, offset, new_capacity)...};
+    }
+
+    static void free_block(void* old_block) {
+        ::operator delete(old_block, std::align_val_t(column_alignment));
+    }
+
+    /*!
+     * @brief Destroys rows [first, last) of column I (dynamic lists only).
+     */
+    template <size_t I>
+    static void destroy_rows(const std::tuple<Fields*...>& target, size_t first, size_t last) {
+        using F = field_type<I>;
+        if constexpr (!std::is_trivially_destructible_v<F>) {
+            for (size_t i = first; i < last; ++i) {
+                std::get<I>(target)[i].~F();
+            }
+        }
+    }
+
+    /*!
+     * @brief True when some field could throw while being moved, so relocation must copy.
+     *
+     * A throw part-way would otherwise leave earlier columns moved-from; copying every column
+     * keeps the old block intact until all new columns are built.
+     */
+    static constexpr bool copy_on_relocate =
+        (!(is_trivially_relocatable<Fields>::value || std::is_nothrow_move_constructible_v<Fields>) || ...);
+
+    /*!
+     * @brief Builds column I of target from this list's column I (sources stay alive).
+     *
+     * Trivially relocatable fields are copied with memcpy; the others are moved, or copied
+     * when copy_on_relocate. If a constructor throws, the rows built so far are destroyed.
+     */
+    template <size_t I>
+    void build_column(const std::tuple<Fields*...>& target) {
+        using F = field_type<I>;
+        F* source = std::get<I>(columns);
+        F* destination = std::get<I>(target);
+        if constexpr (is_trivially_relocatable<F>::value) {
+            if (count > 0) {
+                std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(F));
+            }
+        } else {
+            size_t built = 0;
+            try {
+                for (; built < count; ++built) {
+                    if constexpr (copy_on_relocate) {
+                        ::new (static_cast<void*>(destination + built)) F(static_cast<const F&>(source[built]));
+                    } else {
+                        ::new (static_cast<void*>(destination + built)) F(std::move(source[built]));
+                    }
+                }
+            } catch (...) {
+                destroy_rows<I>(target, 0, built);
+                throw;
+            }
+        }
+    }
+
+    /*!
+     * @brief Ends the old copy of column I after relocation (memcpy'd columns need nothing).
+     */
+    template <size_t I>
+    void retire_column() {
+        if constexpr (!is_trivially_relocatable<field_type<I>>::value) {
+            destroy_rows<I>(columns, 0, count);
+        }
+    }
+
+    /*!
+     * @brief Undoes build_column for a fully built column I of target.
+     */
+    template <size_t I>
+    void unbuild_column(const std::tuple<Fields*...>& target) {
+        if constexpr (!is_trivially_relocatable<field_type<I>>::value) {
+            destroy_rows<I>(target, 0, count);
+        }
+    }
+
+    /*!
+     * @brief Relocates every column into target; the old columns are ended only once all are built.
+     */
+    template <size_t... I>
+    void relocate_columns(const std::tuple<Fields*...>& target, std::index_sequence<I...>) {
+        size_t built = 0;
+        try {
+            ((build_column<I>(target), ++built), ...);
+        } catch (...) {
+            ((I < built ? unbuild_column<I>(target) : void()), ...);
+            throw;
+        }
+        (retire_column<I>(), ...);
+    }
+
+    /*!
+     * @brief Moves the rows into a new block of new_capacity rows.
+     *
+     * @throw std::runtime_error if the list is static or memory reallocation fails
+     */
+    void resize(size_t new_capacity) {
+        if (!is_dynamic) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+        void* new_block = nullptr;
+        try {
+            new_block = ::operator new(block_bytes(new_capacity), std::align_val_t(column_alignment));
+        } catch (const std::bad_alloc&) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+        std::tuple<Fields*...> new_columns = carve(new_block, new_capacity);
+        try {
+            relocate_columns(new_columns, indices{});
+        } catch (...) {
+            free_block(new_block);
+            throw;
+        }
+        if (block != nullptr) {
+            free_block(block);
+        }
+        block = new_block;
+        columns = new_columns;
+        capacity = new_capacity;
+    }
+
+    /*!
+     * @brief Fills row count from values, constructing (dynamic) or assigning (static) each field.
+     */
+    template <size_t... I, typename... Args>
+    void store_row(std::index_sequence<I...>, Args&&... values) {
+        if (is_dynamic) {
+            size_t built = 0;
+            try {
+                ((::new (static_cast<void*>(std::get<I>(columns) + count)) field_type<I>(std::forward<Args>(values)),
+                  ++built),
+                 ...);
+            } catch (...) {
+                ((I < built ? destroy_rows<I>(columns, count, count + 1) : void()), ...);
+                throw;
+            }
+        } else {
+            ((std::get<I>(columns)[count] = std::forward<Args>(values)), ...);
+        }
+    }
+
+    template <size_t... I>
+    void destroy_row(size_t index, std::index_sequence<I...>) {
+        if (is_dynamic) {
+            (destroy_rows<I>(columns, index, index + 1), ...);
+        }
+    }
+
+    void destroy_all() {
+        if (is_dynamic) {
+            destroy_all_columns(indices{});
+        }
+        count = 0;
+    }
+
+    template <size_t... I>
+    void destroy_all_columns(std::index_sequence<I...>) {
+        (destroy_rows<I>(columns, 0, count), ...);
+    }
+
+    void release_storage() {
+        destroy_all();
+        if (block != nullptr) {
+            free_block(block);
+        }
+        block = nullptr;
+        columns = std::tuple<Fields*...>();
+        capacity = 0;
+    }
+
+    template <size_t... I>
+    reference row_at(size_t index, std::index_sequence<I...>) {
+        return reference(std::get<I>(columns)[index]...);
+    }
+
+    template <size_t... I>
+    const_reference row_at(size_t index, std::index_sequence<I...>) const {
+        return const_reference(std::get<I>(columns)[index]...);
+    }
+
+    void take_contents(BasicSoAList& other) {
+        columns = other.columns;
+        block = other.block;
+        count = other.count;
+        capacity = other.capacity;
+        is_dynamic = other.is_dynamic;
+        other.columns = std::tuple<Fields*...>();
+        other.block = nullptr;
+        other.count = 0;
+        other.capacity = 0;
+        other.is_dynamic = true;
+    }
+
+public:
+    /*!
+     * @brief Iterator over row proxies.
+     *
+     * @tparam Const true to yield const_reference rows.
+     */
+    template <bool Const>
+    class RowIterator {
+    private:
+        using Owner = std::conditional_t<Const, const BasicSoAList, BasicSoAList>;
+
+        Owner* list;  ///< The list iterated over
+        size_t index; ///< Current row
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::tuple<Fields...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, typename BasicSoAList::const_reference,
+                                             typename BasicSoAList::reference>;
+        using pointer = void;
+
+        RowIterator(Owner* list, size_t index) : list(list), index(index) {}
+
+        reference operator*() const {
+            return (*list)[index];
+        }
+
+        RowIterator& operator++() {
+            ++index;
+            return *this;
+        }
+
+        RowIterator operator++(int) {
+            RowIterator previous = *this;
+            ++index;
+            return previous;
+        }
+
+        bool operator==(const RowIterator& other) const {
+            return index == other.index;
+        }
+
+        bool operator!=(const RowIterator& other) const {
+            return index != other.index;
+        }
+    };
+
+    using iterator = RowIterator<false>;
+    using const_iterator = RowIterator<true>;
+
+    /*!
+     * @defgroup SoAInitialization Initialization and Destruction Functions
+     * @{
+     */
+
+    /*!
+     * @brief Default constructor that creates an empty list with zero capacity.
+     */
+    BasicSoAList() : columns(), block(nullptr), count(0), capacity(0), is_dynamic(true) {}
+
+    /*!
+     * @brief Creates an empty list with room for capacity rows in every column.
+     *
+     * @param capacity The initial number of rows. Must be > 0.
+     * @throw std::invalid_argument if capacity is 0
+     * @throw std::bad_alloc if memory allocation fails
+     */
+    explicit BasicSoAList(size_t capacity) : BasicSoAList() {
+        if (capacity == 0) {
+            throw std::invalid_argument("Capacity must be greater than 0");
+        }
+        block = ::operator new(block_bytes(capacity), std::align_val_t(column_alignment));
+        columns = carve(block, capacity);
+        this->capacity = capacity;
+    }
+
+    /*!
+     * @brief Destroys the rows and frees the columns if the list allocated them.
+     */
+    ~BasicSoAList() {
+        release_storage();
+    }
+
+    /*!
+     * @brief Uses caller-provided column buffers; the list will not resize itself.
+     *
+     * The buffer slots are treated as objects owned by the caller: the list assigns into them
+     * and never constructs or destroys them.
+     *
+     * @param capacity The number of rows every buffer has room for.
+     * @param buffers One pointer per field, in column order.
+     */
+    void init_static(size_t capacity, Fields*... buffers) {
+        release_storage();
+        columns = std::tuple<Fields*...>(buffers...);
+        this->capacity = capacity;
+        is_dynamic = false;
+    }
+
+    BasicSoAList(const BasicSoAList&) = delete;
+    BasicSoAList& operator=(const BasicSoAList&) = delete;
+
+    /*!
+     * @brief Move constructor; takes over other's columns and leaves it empty.
+     */
+    BasicSoAList(BasicSoAList&& other) noexcept : BasicSoAList() {
+        take_contents(other);
+    }
+
+    /*!
+     * @brief Move assignment operator; takes over other's columns and leaves it empty.
+     */
+    BasicSoAList& operator=(BasicSoAList&& other) noexcept {
+        if (this != &other) {
+            release_storage();
+            is_dynamic = true;
+            take_contents(other);
+        }
+        return *this;
+    }
+
+    /*! @} */ // End of SoAInitialization group
+
+    /*!
+     * @defgroup SoAInformation Basic Information Functions
+     * @{
+     */
+
+    /*!
+     * @brief Gets the current number of rows.
+     */
+    size_t length() const {
+        return count;
+    }
+
+    /*!
+     * @brief Gets the number of rows every column has room for.
+     */
+    size_t get_capacity() const {
+        return capacity;
+    }
+
+    /*!
+     * @brief Checks if the list contains no rows.
+     */
+    bool is_empty() const {
+        return count == 0;
+    }
+
+    /*!
+     * @brief Checks if the columns were allocated by the list.
+     */
+    bool is_dynamic_allocation() const {
+        return is_dynamic;
+    }
+
+    /*! @} */ // End of SoAInformation group
+
+    /*!
+     * @defgroup SoAAccess Column and Row Access
+     * @{
+     */
+
+    /*!
+     * @brief Gets the contiguous column of field I.
+     */
+    template <size_t I>
+    SoAColumn<field_type<I>> column() {
+        return SoAColumn<field_type<I>>(std::get<I>(columns), count);
+    }
+
+    /*!
+     * @brief Gets the read-only contiguous column of field I.
+     */
+    template <size_t I>
+    SoAColumn<const field_type<I>> column() const {
+        return SoAColumn<const field_type<I>>(std::get<I>(columns), count);
+    }
+
+    /*!
+     * @brief Gets a reference to field I of one row, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    template <size_t I>
+    field_type<I>& field(size_t index) {
+        list_detail::check_index(index < count);
+        return std::get<I>(columns)[index];
+    }
+
+    /*!
+     * @brief Gets a const reference to field I of one row, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    template <size_t I>
+    const field_type<I>& field(size_t index) const {
+        list_detail::check_index(index < count);
+        return std::get<I>(columns)[index];
+    }
+
+    /*!
+     * @brief Gets a row proxy (a tuple of references, one per field), with bounds checking.
+     *
+     * Works with structured bindings: auto [id, price] = list.at(i);
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    reference at(size_t index) {
+        list_detail::check_index(index < count);
+        return row_at(index, indices{});
+    }
+
+    /*!
+     * @brief Gets a read-only row proxy, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    const_reference at(size_t index) const {
+        list_detail::check_index(index < count);
+        return row_at(index, indices{});
+    }
+
+    /*!
+     * @brief Gets a row proxy (unchecked).
+     */
+    reference operator[](size_t index) {
+        list_detail::debug_check_index(index < count);
+        return row_at(index, indices{});
+    }
+
+    /*!
+     * @brief Gets a read-only row proxy (unchecked).
+     */
+    const_reference operator[](size_t index) const {
+        list_detail::debug_check_index(index < count);
+        return row_at(index, indices{});
+    }
+
+    iterator begin() {
+        return iterator(this, 0);
+    }
+
+    iterator end() {
+        return iterator(this, count);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, count);
+    }
+
+    /*! @} */ // End of SoAAccess group
+
+    /*!
+     * @defgroup SoAManipulation Row Manipulation Functions
+     * @{
+     */
+
+    /*!
+     * @brief Appends a row, one value per field.
+     *
+     * @param values The field values, in column order.
+     * @throw std::runtime_error if the list is static and full, or if memory reallocation fails
+     */
+    template <typename... Args>
+    void add(Args&&... values) {
+        static_assert(sizeof...(Args) == sizeof...(Fields), "add needs one value per field");
+        if (count < capacity) {
+            store_row(indices{}, std::forward<Args>(values)...);
+        } else {
+            // The values may refer to rows of this list, so copy them out before growing
+            std::tuple<Fields...> row(std::forward<Args>(values)...);
+            resize(Growth::grow(capacity, count + 1, (sizeof(Fields) + ...)));
+            std::apply([this](Fields&... fields) { store_row(indices{}, std::move(fields)...); }, row);
+        }
+        count++;
+    }
+
+    /*!
+     * @brief Removes the row at the specified index, shifting the following rows up in every column.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     */
+    void remove_at(size_t index) {
+        list_detail::check_index(index < count);
+        std::apply([this, index](Fields*... column) { (std::move(column + index + 1, column + count, column + index), ...); },
+                   columns);
+        destroy_row(count - 1, indices{});
+        count--;
+    }
+
+    /*!
+     * @brief Removes the row at the specified index in O(1) by moving the last row into its place.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     */
+    void swap_remove(size_t index) {
+        list_detail::check_index(index < count);
+        if (index != count - 1) {
+            std::apply([this, index](Fields*... column) { ((column[index] = std::move(column[count - 1])), ...); },
+                       columns);
+        }
+        destroy_row(count - 1, indices{});
+        count--;
+    }
+
+    /*!
+     * @brief Ensures every column can hold at least new_capacity rows.
+     *
+     * @throw std::runtime_error if the list is static and too small, or if reallocation fails
+     */
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity) {
+            resize(new_capacity);
+        }
+    }
+
+    /*!
+     * @brief Removes all rows, keeping the columns.
+     */
+    void clear() {
+        destroy_all();
+    }
+
+    /*! @} */ // End of SoAManipulation group
+};
+
+/*!
+ * @brief Structure-of-arrays list with the default growth policy.
+ *
+ * @tparam Fields The field types of one record, in column order.
+ */
+template <typename... Fields>
+using SoAList = BasicSoAList<GrowthDouble, Fields...>;
+
+#endif // LIST_SOA_HPP
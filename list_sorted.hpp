@@ -0,0 +1,364 @@
+/*!
+ * @file list_sorted.hpp
+ * @brief List that keeps its elements ordered, with logarithmic search
+ */
+
+#ifndef LIST_SORTED_HPP
+#define LIST_SORTED_HPP
+
+#include "list.hpp"
+
+#include <algorithm>
+#include <functional>
+
+/*!
+ * @brief A List whose elements are always kept in Compare order.
+ *
+ * Lookups are O(log n) branchless binary searches over the contiguous buffer; insertion
+ * finds its slot the same way and shifts the tail once. Elements are only readable through
+ * const accessors, since modifying one in place could break the ordering.
+ *
+ * @tparam T The element type.
+ * @tparam Compare Strict weak ordering used to sort the elements.
+ * @tparam Allocator Allocator used for the internal buffer.
+ */
+template <typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>>
+class SortedList {
+private:
+    List<T, Allocator> items; ///< The ordered elements
+    Compare comp;             ///< The ordering
+
+public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    /*!
+     * @defgroup SortedInitialization Initialization
+     * @{
+     */
+
+    /*!
+     * @brief Creates an empty sorted list.
+     *
+     * @param comp The ordering to use.
+     * @param alloc The allocator to use.
+     */
+    explicit SortedList(const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+        : items(alloc), comp(comp) {}
+
+    /*!
+     * @brief Builds a sorted list from an unsorted one, sorting it once in place.
+     *
+     * @param source The list to take the elements from.
+     * @param comp The ordering to use.
+     */
+    explicit SortedList(List<T, Allocator>&& source, const Compare& comp = Compare())
+        : items(std::move(source)), comp(comp) {
+        std::stable_sort(items.begin(), items.end(), this->comp);
+    }
+
+    /*! @} */ // End of SortedInitialization group
+
+    /*!
+     * @defgroup SortedInformation Basic Information and Access
+     * @{
+     */
+
+    /*!
+     * @brief Gets the current number of elements in the list.
+     */
+    size_t length() const {
+        return items.length();
+    }
+
+    /*!
+     * @brief Gets the current capacity of the list.
+     */
+    size_t get_capacity() const {
+        return items.get_capacity();
+    }
+
+    /*!
+     * @brief Checks if the list contains no elements.
+     */
+    bool is_empty() const {
+        return items.is_empty();
+    }
+
+    /*!
+     * @brief Gets a const reference to the element at the specified index, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    const T& at(size_t index) const {
+        return items.at(index);
+    }
+
+    /*!
+     * @brief Gets a const reference to the element at the specified index (unchecked).
+     */
+    const T& operator[](size_t index) const {
+        return items[index];
+    }
+
+    /*!
+     * @brief Gets a const pointer to the sorted contiguous buffer.
+     */
+    const T* data() const {
+        return items.data();
+    }
+
+    /*!
+     * @brief Gets a const iterator to the smallest element.
+     */
+    const_iterator begin() const {
+        return items.begin();
+    }
+
+    /*!
+     * @brief Gets a const iterator one past the largest element.
+     */
+    const_iterator end() const {
+        return items.end();
+    }
+
+    /*!
+     * @brief Gets a read-only view of the sorted elements.
+     */
+    ListView<const T> view() const {
+        return items.view();
+    }
+
+    /*!
+     * @brief Gives read-only access to the underlying List.
+     */
+    const List<T, Allocator>& as_list() const {
+        return items;
+    }
+
+    /*! @} */ // End of SortedInformation group
+
+    /*!
+     * @defgroup SortedSearch Binary Search
+     * @{
+     */
+
+    /*!
+     * @brief Finds the first position whose element is not ordered before value.
+     *
+     * @param value The value to search for.
+     * @return An index in [0, length()].
+     */
+    size_t lower_bound(const T& value) const {
+        return list_detail::branchless_lower_bound(items.data(), items.length(), value, comp);
+    }
+
+    /*!
+     * @brief Finds the first position whose element is ordered after value.
+     *
+     * @param value The value to search for.
+     * @return An index in [0, length()].
+     */
+    size_t upper_bound(const T& value) const {
+        return list_detail::branchless_upper_bound(items.data(), items.length(), value, comp);
+    }
+
+    /*!
+     * @brief Checks in O(log n) whether an element equivalent to value is stored.
+     *
+     * @param value The value to check for.
+     * @return true if found, false otherwise.
+     */
+    bool contains_sorted(const T& value) const {
+        size_t index = lower_bound(value);
+        return index < items.length() && !comp(value, items[index]);
+    }
+
+    /*!
+     * @brief Finds the index of the first element equivalent to value in O(log n).
+     *
+     * @param value The value to search for.
+     * @return The zero-based index of the found element, or -1 if not found.
+     */
+    long index_of(const T& value) const {
+        size_t index = lower_bound(value);
+        if (index < items.length() && !comp(value, items[index])) {
+            return static_cast<long>(index);
+        }
+        return -1;
+    }
+
+    /*!
+     * @brief Counts the elements equivalent to value.
+     */
+    size_t count_of(const T& value) const {
+        return upper_bound(value) - lower_bound(value);
+    }
+
+    /*! @} */ // End of SortedSearch group
+
+    /*!
+     * @defgroup SortedManipulation Element Manipulation
+     * @{
+     */
+
+    /*!
+     * @brief Inserts value at its ordered position, after any equivalent elements.
+     *
+     * @param value The value to insert.
+     * @return The index the value was stored at.
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    size_t insert_sorted(const T& value) {
+        size_t index = upper_bound(value);
+        items.insert(index, value);
+        return index;
+    }
+
+    /*!
+     * @brief Moves value into its ordered position, after any equivalent elements.
+     *
+     * @param value The value to insert.
+     * @return The index the value was stored at.
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    size_t insert_sorted(T&& value) {
+        size_t index = upper_bound(value);
+        items.insert(index, std::move(value));
+        return index;
+    }
+
+    /*!
+     * @brief Merges a sorted batch of n elements into the list in one pass.
+     *
+     * The buffer grows once; the merge then runs from the back into the new slots, so every
+     * existing element moves at most once. Equivalent elements keep list-before-batch order.
+     * The batch must not point into this list.
+     *
+     * If an assignment throws part-way, the list is re-sorted before the exception
+     * propagates: it stays ordered, but which of its and the batch's elements it holds is
+     * unspecified.
+     *
+     * @param first Pointer to the batch, which must already be in Compare order.
+     * @param n Number of elements in the batch.
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void merge_sorted(const T* first, size_t n) {
+        if (n == 0) {
+            return;
+        }
+        size_t old_count = items.length();
+        items.append(first, n); // Grows once and builds the n new slots
+
+        // Merge backwards from the ends of both sequences into the grown buffer
+        T* buffer = items.data();
+        size_t out = old_count + n;
+        size_t left = old_count;
+        size_t right = n;
+        try {
+            while (right > 0 && left > 0) {
+                if (comp(first[right - 1], buffer[left - 1])) {
+                    buffer[--out] = std::move(buffer[--left]);
+                } else {
+                    buffer[--out] = first[--right];
+                }
+            }
+            while (right > 0) {
+                buffer[--out] = first[--right];
+            }
+        } catch (...) {
+            std::stable_sort(items.begin(), items.end(), comp);
+            throw;
+        }
+    }
+
+    /*!
+     * @brief Merges all elements of another sorted list into this one, leaving it empty.
+     *
+     * The elements of both lists are moved, not copied, into a buffer sized once for the
+     * result. If a move throws part-way, both lists are re-sorted before the exception
+     * propagates: they stay ordered, but which elements each holds is unspecified.
+     *
+     * @param other The list to merge from.
+     * @throw std::runtime_error if memory reallocation fails
+     */
+    void merge_sorted(SortedList&& other) {
+        if (this == &other || other.items.is_empty()) {
+            return;
+        }
+        if (items.is_empty()) {
+            items = std::move(other.items);
+            other.items.clear();
+            return;
+        }
+
+        List<T, Allocator> merged(items.get_allocator());
+        merged.reserve(items.length() + other.items.length());
+        size_t left = 0;
+        size_t right = 0;
+        try {
+            while (left < items.length() && right < other.items.length()) {
+                if (comp(other.items[right], items[left])) {
+                    merged.add(std::move(other.items[right++]));
+                } else {
+                    merged.add(std::move(items[left++]));
+                }
+            }
+            while (left < items.length()) {
+                merged.add(std::move(items[left++]));
+            }
+            while (right < other.items.length()) {
+                merged.add(std::move(other.items[right++]));
+            }
+        } catch (...) {
+            std::stable_sort(items.begin(), items.end(), comp);
+            std::stable_sort(other.items.begin(), other.items.end(), comp);
+            throw;
+        }
+        items = std::move(merged);
+        other.items.clear();
+    }
+
+    /*!
+     * @brief Removes the element at the specified index.
+     *
+     * @param index The index of the element to remove. Must be < length().
+     * @throw std::out_of_range if index is out of bounds
+     */
+    void remove_at(size_t index) {
+        items.remove_at(index);
+    }
+
+    /*!
+     * @brief Removes every element equivalent to value.
+     *
+     * @param value The value to remove.
+     * @return The number of elements removed.
+     */
+    size_t remove_value(const T& value) {
+        size_t begin = lower_bound(value);
+        size_t end = upper_bound(value);
+        items.remove_range(begin, end);
+        return end - begin;
+    }
+
+    /*!
+     * @brief Ensures the list can hold at least new_capacity elements without reallocating.
+     *
+     * @throw std::runtime_error if reallocation fails
+     */
+    void reserve(size_t new_capacity) {
+        items.reserve(new_capacity);
+    }
+
+    /*!
+     * @brief Removes all elements, keeping the buffer.
+     */
+    void clear() {
+        items.clear();
+    }
+
+    /*! @} */ // End of SortedManipulation group
+};
+
+#endif // LIST_SORTED_HPP
@@ -0,0 +1,318 @@
+/*!
+ * @file list_static.hpp
+ * @brief Fixed-capacity list with inline storage, usable in constant expressions
+ */
+
+#ifndef LIST_STATIC_HPP
+#define LIST_STATIC_HPP
+
+#include "list.hpp"
+
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define LIST_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#if !defined(LIST_IS_CONSTANT_EVALUATED)
+#define LIST_IS_CONSTANT_EVALUATED() true // Without the builtin, always take the constexpr-safe path
+#endif
+
+/*!
+ * @brief A list of at most N elements stored in a member array.
+ *
+ * Unlike a List set up with init_static, the buffer is part of the object and the capacity
+ * is a compile-time constant, so there is no allocation, no dynamic/static flag and no
+ * growth path. Every operation is constexpr, so tables can be built at compile time:
+ *
+ *     constexpr auto primes = [] {
+ *         StaticList<int, 8> p;
+ *         for (int n = 2; p.length() < 8; n++) { ... p.add(n); }
+ *         return p;
+ *     }();
+ *
+ * All N slots are value-initialized objects, so T must be default-constructible and, for
+ * constant evaluation, a literal type. Unlike List, StaticList is copyable.
+ *
+ * @tparam T The element type.
+ * @tparam N The capacity. Must be > 0.
+ */
+template <typename T, size_t N>
+class StaticList {
+    static_assert(N > 0, "StaticList needs room for at least one element");
+    static_assert(std::is_default_constructible_v<T>, "StaticList slots are default-constructed");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+private:
+    T items[N];   ///< The storage; slots past count hold default-constructed values
+    size_t count; ///< The current number of elements stored
+
+    constexpr void check_room() const {
+        if (count == N) {
+            throw std::runtime_error("Failed to reallocate memory for list expansion");
+        }
+    }
+
+public:
+    /*!
+     * @defgroup StaticInitialization Initialization
+     * @{
+     */
+
+    /*!
+     * @brief Creates an empty list.
+     */
+    constexpr StaticList() : items(), count(0) {}
+
+    /*!
+     * @brief Creates a list holding the given values.
+     *
+     * @throw std::runtime_error if more than N values are given
+     */
+    constexpr StaticList(std::initializer_list<T> values) : items(), count(0) {
+        for (const T& value : values) {
+            add(value);
+        }
+    }
+
+    /*! @} */ // End of StaticInitialization group
+
+    /*!
+     * @defgroup StaticInformation Basic Information and Access
+     * @{
+     */
+
+    /*!
+     * @brief Gets the current number of elements in the list.
+     */
+    constexpr size_t length() const {
+        return count;
+    }
+
+    /*!
+     * @brief Gets the capacity, N.
+     */
+    static constexpr size_t get_capacity() {
+        return N;
+    }
+
+    /*!
+     * @brief Checks if the list contains no elements.
+     */
+    constexpr bool is_empty() const {
+        return count == 0;
+    }
+
+    /*!
+     * @brief Checks if the list holds N elements.
+     */
+    constexpr bool is_full() const {
+        return count == N;
+    }
+
+    /*!
+     * @brief Gets a reference to the element at the specified index, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    constexpr T& at(size_t index) {
+        list_detail::check_index(index < count);
+        return items[index];
+    }
+
+    /*!
+     * @brief Gets a const reference to the element at the specified index, with bounds checking.
+     *
+     * @throw std::out_of_range if the index is out of bounds
+     */
+    constexpr const T& at(size_t index) const {
+        list_detail::check_index(index < count);
+        return items[index];
+    }
+
+    /*!
+     * @brief Gets a reference to the element at the specified index (unchecked).
+     */
+    constexpr T& operator[](size_t index) {
+        list_detail::debug_check_index(index < count);
+        return items[index];
+    }
+
+    /*!
+     * @brief Gets a const reference to the element at the specified index (unchecked).
+     */
+    constexpr const T& operator[](size_t index) const {
+        list_detail::debug_check_index(index < count);
+        return items[index];
+    }
+
+    constexpr T* data() {
+        return items;
+    }
+
+    constexpr const T* data() const {
+        return items;
+    }
+
+    constexpr iterator begin() {
+        return items;
+    }
+
+    constexpr iterator end() {
+        return items + count;
+    }
+
+    constexpr const_iterator begin() const {
+        return items;
+    }
+
+    constexpr const_iterator end() const {
+        return items + count;
+    }
+
+    /*! @} */ // End of StaticInformation group
+
+    /*!
+     * @defgroup StaticManipulation Element Manipulation Functions
+     * @{
+     */
+
+    /*!
+     * @brief Adds a copy of element at the end of the list.
+     *
+     * @throw std::runtime_error if the list is full
+     */
+    constexpr void add(const T& element) {
+        check_room();
+        items[count++] = element;
+    }
+
+    /*!
+     * @brief Moves element to the end of the list.
+     *
+     * @throw std::runtime_error if the list is full
+     */
+    constexpr void add(T&& element) {
+        check_room();
+        items[count++] = std::move(element);
+    }
+
+    /*!
+     * @brief Inserts element at index, shifting subsequent elements right.
+     *
+     * @param index The position to insert at. Must be <= length().
+     * @param element The element to insert.
+     * @throw std::out_of_range if index is out of bounds
+     * @throw std::runtime_error if the list is full
+     */
+    constexpr void insert(size_t index, T element) {
+        list_detail::check_index(index <= count);
+        check_room();
+        for (size_t i = count; i > index; --i) {
+            items[i] = std::move(items[i - 1]);
+        }
+        items[index] = std::move(element);
+        count++;
+    }
+
+    /*!
+     * @brief Removes the element at the specified index, shifting subsequent elements left.
+     *
+     * The freed slot is reset to a default-constructed value.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     */
+    constexpr void remove_at(size_t index) {
+        list_detail::check_index(index < count);
+        for (size_t i = index + 1; i < count; ++i) {
+            items[i - 1] = std::move(items[i]);
+        }
+        items[--count] = T();
+    }
+
+    /*!
+     * @brief Removes the element at the specified index in O(1) by moving the last element into its place.
+     *
+     * @throw std::out_of_range if index is out of bounds
+     */
+    constexpr void swap_remove(size_t index) {
+        list_detail::check_index(index < count);
+        if (index != count - 1) {
+            items[index] = std::move(items[count - 1]);
+        }
+        items[--count] = T();
+    }
+
+    /*!
+     * @brief Removes all elements, resetting their slots to default-constructed values.
+     */
+    constexpr void clear() {
+        for (size_t i = 0; i < count; ++i) {
+            items[i] = T();
+        }
+        count = 0;
+    }
+
+    /*! @} */ // End of StaticManipulation group
+
+    /*!
+     * @defgroup StaticSearch Search Functions
+     * @{
+     */
+
+    /*!
+     * @brief Finds the index of the first element equal to value.
+     *
+     * At run time this uses the SIMD kernels of List::index_of; during constant evaluation
+     * it falls back to a plain loop.
+     *
+     * @return The zero-based index of the found element, or -1 if not found.
+     */
+    constexpr long index_of(const T& value) const {
+        if (!LIST_IS_CONSTANT_EVALUATED()) {
+            return list_simd::find_first(items, count, value);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (items[i] == value) {
+                return static_cast<long>(i);
+            }
+        }
+        return -1;
+    }
+
+    /*!
+     * @brief Counts the elements equal to value.
+     */
+    constexpr size_t count_of(const T& value) const {
+        if (!LIST_IS_CONSTANT_EVALUATED()) {
+            return list_simd::count_equal(items, count, value);
+        }
+        size_t hits = 0;
+        for (size_t i = 0; i < count; ++i) {
+            hits += (items[i] == value) ? 1 : 0;
+        }
+        return hits;
+    }
+
+    /*!
+     * @brief Checks if the list contains value.
+     */
+    constexpr bool contains(const T& value) const {
+        return index_of(value) >= 0;
+    }
+
+    /*! @} */ // End of StaticSearch group
+};
+
+#endif // LIST_STATIC_HPP
@@ -0,0 +1,263 @@
+/*!
+ * @file list_stats.hpp
+ * @brief Opt-in allocation and operation counters for List, with a global registry
+ *
+ * Select CountingListStats as a list's Stats policy to record what it does:
+ *
+ *     List<Order, std::allocator<Order>, GrowthDouble, CountingListStats> orders;
+ *     orders.stats().set_label("pending orders");
+ *     ...
+ *     ListStatsRegistry::instance().dump(std::cerr);
+ */
+
+#ifndef LIST_STATS_HPP
+#define LIST_STATS_HPP
+
+#include "list.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <ostream>
+
+/*!
+ * @brief Point-in-time copy of one list's counters.
+ */
+struct ListStatsSnapshot {
+    const char* label;         ///< Name given with set_label (or "unnamed")
+    size_t allocations;        ///< Buffers allocated, including the first one
+    size_t reallocations;      ///< Moves of the elements into a new buffer
+    size_t bytes_allocated;    ///< Total bytes requested from the allocator
+    size_t live_bytes;         ///< Bytes currently held
+    size_t elements_relocated; ///< Elements moved or copied by reallocations
+    size_t shifts;             ///< Insertions and removals that shifted elements
+    size_t shift_distance;     ///< Total elements moved by those shifts
+    size_t peak_capacity;      ///< Largest capacity ever allocated
+    size_t searches;           ///< Calls to the search functions
+    size_t search_probes;      ///< Elements examined by those searches
+};
+
+class CountingListStats;
+
+/*!
+ * @brief Process-wide set of every live CountingListStats, for dumping from anywhere.
+ */
+class ListStatsRegistry {
+private:
+    mutable std::mutex lock;           ///< Guards the intrusive list
+    CountingListStats* head = nullptr; ///< First registered list
+
+    friend class CountingListStats;
+
+    ListStatsRegistry() = default;
+
+    void add(CountingListStats* stats);
+    void remove(CountingListStats* stats);
+
+public:
+    ListStatsRegistry(const ListStatsRegistry&) = delete;
+    ListStatsRegistry& operator=(const ListStatsRegistry&) = delete;
+
+    /*!
+     * @brief Gets the registry instance.
+     */
+    static ListStatsRegistry& instance() {
+        static ListStatsRegistry registry;
+        return registry;
+    }
+
+    /*!
+     * @brief Calls fn with a snapshot of every registered list.
+     *
+     * The registry lock is held during the walk, so fn must not create or destroy lists
+     * with counting statistics.
+     *
+     * @param fn Callable taking a const ListStatsSnapshot&.
+     */
+    template <typename Fn>
+    void for_each(Fn fn) const;
+
+    /*!
+     * @brief Gets the number of registered lists.
+     */
+    size_t size() const;
+
+    /*!
+     * @brief Writes one line per registered list to os.
+     *
+     * @param os The output stream to write to.
+     */
+    void dump(std::ostream& os) const;
+};
+
+/*!
+ * @brief Statistics policy that counts every allocation, reallocation, shift and search.
+ *
+ * Each counter has a single writer (the thread using the list) and is updated with relaxed
+ * loads and stores, which compile to ordinary arithmetic yet can be read safely by a thread
+ * dumping the registry. Each instance registers itself on construction; a moved-to list
+ * starts with fresh counters, except that live_bytes follows the buffer it takes over.
+ */
+class CountingListStats {
+private:
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> reallocations{0};
+    std::atomic<size_t> bytes_allocated{0};
+    std::atomic<size_t> live_bytes{0};
+    std::atomic<size_t> elements_relocated{0};
+    std::atomic<size_t> shifts{0};
+    std::atomic<size_t> shift_distance{0};
+    std::atomic<size_t> peak_capacity{0};
+    std::atomic<size_t> searches{0};
+    std::atomic<size_t> search_probes{0};
+    std::atomic<const char*> label{"unnamed"};
+
+    CountingListStats* prev = nullptr; ///< Registry neighbors (guarded by the registry lock)
+    CountingListStats* next = nullptr;
+
+    friend class ListStatsRegistry;
+
+    static void bump(std::atomic<size_t>& counter, size_t amount) {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+public:
+    CountingListStats() {
+        ListStatsRegistry::instance().add(this);
+    }
+
+    CountingListStats(const CountingListStats&) : CountingListStats() {}
+
+    CountingListStats& operator=(const CountingListStats&) {
+        return *this; // Counters belong to the list object, not to its contents
+    }
+
+    ~CountingListStats() {
+        ListStatsRegistry::instance().remove(this);
+    }
+
+    /*!
+     * @defgroup StatsHooks Hooks called by List
+     * @{
+     */
+
+    void on_allocate(size_t capacity, size_t bytes) {
+        bump(allocations, 1);
+        bump(bytes_allocated, bytes);
+        bump(live_bytes, bytes);
+        if (capacity > peak_capacity.load(std::memory_order_relaxed)) {
+            peak_capacity.store(capacity, std::memory_order_relaxed);
+        }
+    }
+
+    void on_deallocate(size_t bytes) {
+        live_bytes.store(live_bytes.load(std::memory_order_relaxed) - bytes, std::memory_order_relaxed);
+    }
+
+    /*!
+     * @brief Takes over the live bytes of a buffer moved here from source's list.
+     */
+    void on_adopt(CountingListStats& source, size_t bytes) {
+        source.on_deallocate(bytes);
+        bump(live_bytes, bytes);
+    }
+
+    void on_reallocate(size_t relocated_elements) {
+        bump(reallocations, 1);
+        bump(elements_relocated, relocated_elements);
+    }
+
+    void on_shift(size_t moved_elements) {
+        bump(shifts, 1);
+        bump(shift_distance, moved_elements);
+    }
+
+    void on_search(size_t probes) {
+        bump(searches, 1);
+        bump(search_probes, probes);
+    }
+
+    /*! @} */ // End of StatsHooks group
+
+    /*!
+     * @brief Names the list in registry dumps.
+     *
+     * @param name A string that outlives the list (typically a literal).
+     */
+    void set_label(const char* name) {
+        label.store(name, std::memory_order_relaxed);
+    }
+
+    /*!
+     * @brief Copies the current counters.
+     */
+    ListStatsSnapshot snapshot() const {
+        return {label.load(std::memory_order_relaxed),
+                allocations.load(std::memory_order_relaxed),
+                reallocations.load(std::memory_order_relaxed),
+                bytes_allocated.load(std::memory_order_relaxed),
+                live_bytes.load(std::memory_order_relaxed),
+                elements_relocated.load(std::memory_order_relaxed),
+                shifts.load(std::memory_order_relaxed),
+                shift_distance.load(std::memory_order_relaxed),
+                peak_capacity.load(std::memory_order_relaxed),
+                searches.load(std::memory_order_relaxed),
+                search_probes.load(std::memory_order_relaxed)};
+    }
+
+    /*!
+     * @brief Zeroes every counter except live_bytes, which still tracks the held buffer.
+     */
+    void reset() {
+        for (std::atomic<size_t>* counter : {&allocations, &reallocations, &bytes_allocated, &elements_relocated,
+                                             &shifts, &shift_distance, &peak_capacity, &searches, &search_probes}) {
+            counter->store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+inline void ListStatsRegistry::add(CountingListStats* stats) {
+    std::lock_guard<std::mutex> guard(lock);
+    stats->next = head;
+    if (head != nullptr) {
+        head->prev = stats;
+    }
+    head = stats;
+}
+
+inline void ListStatsRegistry::remove(CountingListStats* stats) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (stats->prev != nullptr) {
+        stats->prev->next = stats->next;
+    } else {
+        head = stats->next;
+    }
+    if (stats->next != nullptr) {
+        stats->next->prev = stats->prev;
+    }
+}
+
+template <typename Fn>
+void ListStatsRegistry::for_each(Fn fn) const {
+    std::lock_guard<std::mutex> guard(lock);
+    for (const CountingListStats* stats = head; stats != nullptr; stats = stats->next) {
+        fn(stats->snapshot());
+    }
+}
+
+inline size_t ListStatsRegistry::size() const {
+    size_t total = 0;
+    for_each([&total](const ListStatsSnapshot&) { total++; });
+    return total;
+}
+
+inline void ListStatsRegistry::dump(std::ostream& os) const {
+    for_each([&os](const ListStatsSnapshot& s) {
+        os << s.label << ": allocations=" << s.allocations << " reallocations=" << s.reallocations
+           << " bytes_allocated=" << s.bytes_allocated << " live_bytes=" << s.live_bytes
+           << " elements_relocated=" << s.elements_relocated << " shifts=" << s.shifts
+           << " shift_distance=" << s.shift_distance << " peak_capacity=" << s.peak_capacity
+           << " searches=" << s.searches << " search_probes=" << s.search_probes << "\n";
+    });
+}
+
+#endif // LIST_STATS_HPP
@@ -4,11 +4,176 @@
  */
 
 #include "list.hpp"
+#include "list_alloc.hpp"
+#include "list_channel.hpp"
+#include "list_chunked.hpp"
+#include "list_concurrent.hpp"
+#include "list_incremental.hpp"
+#include "list_indexed.hpp"
+#include "list_io.hpp"
+#include "list_mapped.hpp"
+#include "list_packed.hpp"
+#include "list_parallel.hpp"
+#include "list_pipeline.hpp"
+#include "list_ring.hpp"
+#include "list_shared.hpp"
+#include "list_soa.hpp"
+#include "list_static.hpp"
+#include "list_sorted.hpp"
+#include "list_stats.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cctype>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
+
+/*!
+ * @brief Element type that counts how it is constructed, used to verify growth behavior.
+ */
+struct Tracked {
+    static int default_constructions;
+    static int copies;
+    static int moves;
+
+    int value;
+
+    Tracked() : value(0) { ++default_constructions; }
+    explicit Tracked(int v) : value(v) {}
+    Tracked(const Tracked& other) : value(other.value) { ++copies; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++moves; }
+    Tracked& operator=(const Tracked& other) { value = other.value; ++copies; return *this; }
+    Tracked& operator=(Tracked&& other) noexcept { value = other.value; ++moves; return *this; }
+
+    static void reset() {
+        default_constructions = 0;
+        copies = 0;
+        moves = 0;
+    }
+};
+
+int Tracked::default_constructions = 0;
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+/*!
+ * @brief Non-trivially-copyable type that opts in to memcpy relocation.
+ */
+struct Relocatable : Tracked {
+    explicit Relocatable(int v) : Tracked(v) {}
+};
+
+template <>
+struct is_trivially_relocatable<Relocatable> : std::true_type {};
+
+/*!
+ * @brief Allocator that counts allocations and live bytes through a shared counter block.
+ */
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    struct Counters {
+        int allocations = 0;
+        long live_bytes = 0;
+    };
+
+    Counters* counters;
+
+    explicit CountingAllocator(Counters* c) : counters(c) {}
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other) : counters(other.counters) {}
+
+    T* allocate(size_t n) {
+        counters->allocations++;
+        counters->live_bytes += static_cast<long>(n * sizeof(T));
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) {
+        counters->live_bytes -= static_cast<long>(n * sizeof(T));
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    bool operator==(const CountingAllocator& other) const { return counters == other.counters; }
+    bool operator!=(const CountingAllocator& other) const { return counters != other.counters; }
+};
+
+// Built entirely during constant evaluation by the StaticList tests
+constexpr StaticList<int, 10> first_primes() {
+    StaticList<int, 10> primes;
+    for (int n = 2; !primes.is_full(); n++) {
+        bool prime = true;
+        for (int p : primes) {
+            prime = prime && (n % p != 0);
+        }
+        if (prime) {
+            primes.add(n);
+        }
+    }
+    return primes;
+}
+
+constexpr StaticList<int, 8> edited_table() {
+    StaticList<int, 8> table{1, 2, 4, 5};
+    table.insert(2, 3); // 1 2 3 4 5
+    table.remove_at(0); // 2 3 4 5
+    table.swap_remove(0); // 5 3 4
+    return table;
+}
+
+constexpr StaticList<int, 10> prime_table = first_primes();
+static_assert(prime_table.length() == 10 && prime_table[9] == 29, "primes built at compile time");
+static_assert(prime_table.index_of(13) == 5 && !prime_table.contains(15), "constexpr search");
+static_assert(edited_table().length() == 3 && edited_table()[0] == 5 && edited_table()[2] == 4,
+              "constexpr insert/remove");
+
+#if LIST_HAS_COROUTINES
+// Eagerly started coroutine that frees itself when it finishes, for the ListChannel tests
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+DetachedTask channel_producer(ListChannel<int>& channel, int first, int n, int& accepted) {
+    for (int i = first; i < first + n; i++) {
+        if (co_await channel.push_async(i)) {
+            accepted++;
+        }
+    }
+}
+
+DetachedTask channel_consumer(ListChannel<int>& channel, List<int>& received) {
+    while (std::optional<int> value = co_await channel.pop_async()) {
+        received.add(*value);
+    }
+}
+
+DetachedTask channel_batch_consumer(ListChannel<int>& channel, List<int>& received, int& batches) {
+    List<int> batch;
+    while (size_t n = co_await channel.pop_all_async(batch)) {
+        received.append(batch.data(), n);
+        batches++;
+    }
+}
+#endif
 
 /*!
  * @brief Runs all unit tests for the List data structure.
@@ -57,6 +222,7 @@ int main() {
         assert(static_list.get_capacity() == STATIC_CAPACITY);
         assert(static_list.length() == 0);
         assert(static_list.is_dynamic_allocation() == false);
+        static_list.add(7);
         assert(static_list.get_element(0) == &static_buffer[0]);
         std::cout << "PASSED" << std::endl;
     }
@@ -103,6 +269,7 @@ int main() {
         assert(*list.get_element(1) == 99);
 
         // Test invalid indices (should throw exceptions)
+#ifndef LIST_NO_CHECKS
         bool caught_exception = false;
         try {
             list.get_element(3);
@@ -118,6 +285,7 @@ int main() {
             caught_exception = true;
         }
         assert(caught_exception);
+#endif
 
         std::cout << "PASSED" << std::endl;
     }
@@ -169,6 +337,7 @@ int main() {
         }
 
         // Test invalid index (should throw exception)
+#ifndef LIST_NO_CHECKS
         bool caught_exception = false;
         try {
             list.insert(7, 50); // Out of bounds
@@ -176,6 +345,7 @@ int main() {
             caught_exception = true;
         }
         assert(caught_exception);
+#endif
 
         std::cout << "PASSED" << std::endl;
     }
@@ -209,6 +379,7 @@ int main() {
         }
 
         // Test invalid index (should throw exception)
+#ifndef LIST_NO_CHECKS
         bool caught_exception = false;
         try {
             list.remove_at(2); // Out of bounds
@@ -216,6 +387,7 @@ int main() {
             caught_exception = true;
         }
         assert(caught_exception);
+#endif
 
         std::cout << "PASSED" << std::endl;
     }
@@ -361,6 +533,2525 @@ int main() {
         std::cout << "PASSED" << std::endl;
     }
 
+    // Test suite 7: Growth and Relocation
+    std::cout << "\n=== Test Suite 7: Growth & Relocation ===" << std::endl;
+
+    // Test 7.1: Growth moves elements instead of copying them
+    {
+        std::cout << "Test 7.1: Growth moves elements instead of copying... ";
+        List<Tracked> list(1);
+        Tracked::reset();
+        for (int i = 0; i < 100; i++) {
+            Tracked t(i);
+            list.add(t);
+        }
+        assert(Tracked::copies == 100); // One copy per add, none during growth
+        assert(Tracked::default_constructions == 0); // Unused slots are never constructed
+        assert(Tracked::moves > 0);
+        for (int i = 0; i < 100; i++) {
+            assert(list[i].value == i);
+        }
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 7.2: Strings survive growth, insert and remove
+    {
+        std::cout << "Test 7.2: Strings survive growth, insert and remove... ";
+        List<std::string> list;
+        for (int i = 0; i < 50; i++) {
+            list.add(std::string(40, static_cast<char>('a' + i % 26)));
+        }
+        list.insert(0, "front");
+        list.insert(10, list[0]); // Argument aliases an element of the list
+        list.remove_at(1);
+        assert(list.length() == 51);
+        assert(list[0] == "front");
+        assert(list[9] == "front");
+        assert(list[50] == std::string(40, static_cast<char>('a' + 49 % 26)));
+
+        list.add(list[0]); // Aliasing argument across a growth
+        assert(list[list.length() - 1] == "front");
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 7.3: Types marked trivially relocatable grow via memcpy
+    {
+        std::cout << "Test 7.3: Trivially relocatable marker... ";
+        List<Relocatable> list;
+        Tracked::reset();
+        for (int i = 0; i < 33; i++) {
+            Relocatable r(i);
+            list.add(r);
+        }
+        assert(Tracked::copies == 33);
+        assert(Tracked::moves == 0); // Growth used memcpy, not the move constructor
+        for (int i = 0; i < 33; i++) {
+            assert(list[i].value == i);
+        }
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 8: Emplacement and Rvalue Insertion
+    std::cout << "\n=== Test Suite 8: Emplacement & Rvalue Insertion ===" << std::endl;
+
+    // Test 8.1: Rvalue add/insert move instead of copying
+    {
+        std::cout << "Test 8.1: Rvalue add and insert... ";
+        List<Tracked> list(8);
+        Tracked::reset();
+        list.add(Tracked(1));
+        list.add(Tracked(3));
+        list.insert(1, Tracked(2));
+        assert(Tracked::copies == 0);
+        assert(list[0].value == 1 && list[1].value == 2 && list[2].value == 3);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 8.2: Emplace constructs in place
+    {
+        std::cout << "Test 8.2: Emplace and emplace_at... ";
+        List<Tracked> list(4);
+        Tracked::reset();
+        Tracked& back = list.emplace(10);
+        assert(back.value == 10);
+        assert(Tracked::copies == 0 && Tracked::moves == 0);
+
+        list.emplace(30);
+        Tracked& middle = list.emplace_at(1, 20);
+        assert(middle.value == 20);
+        assert(Tracked::copies == 0);
+        assert(list[0].value == 10 && list[1].value == 20 && list[2].value == 30);
+
+#ifndef LIST_NO_CHECKS
+        bool caught_exception = false;
+        try {
+            list.emplace_at(5, 40);
+        } catch (const std::out_of_range& e) {
+            caught_exception = true;
+        }
+        assert(caught_exception);
+#endif
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 8.3: Move-only element types
+    {
+        std::cout << "Test 8.3: Move-only element types... ";
+        List<std::unique_ptr<int>> list;
+        for (int i = 0; i < 20; i++) {
+            list.add(std::make_unique<int>(i));
+        }
+        list.insert(0, std::make_unique<int>(-1));
+        list.emplace_at(5, new int(100));
+        list.remove_at(1);
+        assert(list.length() == 21);
+        assert(*list[0] == -1);
+        assert(*list[4] == 100);
+        assert(*list[20] == 19);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 9: Allocator Support
+    std::cout << "\n=== Test Suite 9: Allocator Support ===" << std::endl;
+
+    // Test 9.1: Custom allocator owns every buffer
+    {
+        std::cout << "Test 9.1: Custom allocator owns every buffer... ";
+        CountingAllocator<int>::Counters counters;
+        {
+            List<int, CountingAllocator<int>> list(2, CountingAllocator<int>(&counters));
+            for (int i = 0; i < 10; i++) {
+                list.add(i);
+            }
+            assert(counters.allocations == 4); // 2 -> 4 -> 8 -> 16
+            assert(counters.live_bytes == static_cast<long>(16 * sizeof(int)));
+            assert(list.get_allocator().counters == &counters);
+        }
+        assert(counters.live_bytes == 0);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 9.2: Move assignment between unequal allocators
+    {
+        std::cout << "Test 9.2: Move assignment between unequal allocators... ";
+        CountingAllocator<std::string>::Counters first_counters;
+        CountingAllocator<std::string>::Counters second_counters;
+        {
+            using StringList = List<std::string, CountingAllocator<std::string>>;
+            CountingAllocator<std::string> first_alloc(&first_counters);
+            CountingAllocator<std::string> second_alloc(&second_counters);
+            StringList first(first_alloc);
+            StringList second(second_alloc);
+            first.add("alpha");
+            first.add("beta");
+            second = std::move(first);
+            assert(second.length() == 2);
+            assert(second[1] == "beta");
+            assert(first.length() == 0);
+            assert(first_counters.live_bytes == 0); // other's buffer was freed by its own allocator
+            assert(second_counters.live_bytes > 0);
+        }
+        assert(second_counters.live_bytes == 0);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+#if __has_include(<memory_resource>)
+    // Test 9.3: Lists backed by a monotonic arena
+    {
+        std::cout << "Test 9.3: Lists backed by a monotonic arena... ";
+        unsigned char arena_buffer[4096];
+        std::pmr::monotonic_buffer_resource arena(arena_buffer, sizeof(arena_buffer),
+                                                  std::pmr::null_memory_resource());
+        pmr::List<int> numbers(&arena);
+        pmr::List<std::pmr::string> names(&arena);
+        for (int i = 0; i < 100; i++) {
+            numbers.add(i);
+        }
+        names.emplace("a string long enough to need its own heap block");
+        assert(numbers.length() == 100 && numbers[99] == 99);
+        assert(names[0].get_allocator().resource() == &arena); // Elements use the arena too
+
+        std::cout << "PASSED" << std::endl;
+    }
+#endif
+
+    // Test suite 10: Small-Buffer Lists
+    std::cout << "\n=== Test Suite 10: Small-Buffer Lists ===" << std::endl;
+
+    // Test 10.1: Inline storage until the list overflows
+    {
+        std::cout << "Test 10.1: Inline storage until overflow... ";
+        CountingAllocator<int>::Counters counters;
+        {
+            SmallList<int, 4, CountingAllocator<int>> list{CountingAllocator<int>(&counters)};
+            assert(list.get_capacity() == 4);
+            assert(list.is_inline_storage());
+            for (int i = 0; i < 4; i++) {
+                list.add(i);
+            }
+            assert(counters.allocations == 0);
+            assert(list.is_inline_storage());
+
+            list.add(4); // Spills to the heap
+            assert(counters.allocations == 1);
+            assert(!list.is_inline_storage());
+            assert(list.is_dynamic_allocation());
+            assert(list.get_capacity() == 8);
+            for (int i = 0; i < 5; i++) {
+                assert(list[i] == i);
+            }
+        }
+        assert(counters.live_bytes == 0);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 10.2: Moving small lists
+    {
+        std::cout << "Test 10.2: Moving small lists... ";
+        SmallList<std::string, 2> small;
+        small.add("one");
+        small.add("two");
+
+        SmallList<std::string, 2> moved(std::move(small));
+        assert(moved.is_inline_storage());
+        assert(moved.length() == 2 && moved[1] == "two");
+        assert(small.length() == 0 && small.is_inline_storage());
+
+        SmallList<std::string, 2> spilled;
+        for (int i = 0; i < 5; i++) {
+            spilled.add(std::to_string(i));
+        }
+        moved = std::move(spilled);
+        assert(moved.length() == 5 && moved[4] == "4");
+        assert(!moved.is_inline_storage());
+        assert(spilled.is_inline_storage() && spilled.is_empty());
+        spilled.add("reused");
+        assert(spilled[0] == "reused");
+
+        // Moving into a plain List relocates out of the inline buffer
+        List<std::string> plain(std::move(small = std::move(spilled)));
+        assert(plain.length() == 1 && plain[0] == "reused");
+        assert(plain.is_dynamic_allocation());
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 10.3: Small lists work through List references
+    {
+        std::cout << "Test 10.3: Small lists through List references... ";
+        SmallList<int, 8> small;
+        List<int>& as_list = small;
+        as_list.add(1);
+        as_list.insert(0, 0);
+        as_list.remove_at(1);
+        assert(small.length() == 1 && small[0] == 0);
+        assert(as_list.contains(0));
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 11: Capacity Management
+    std::cout << "\n=== Test Suite 11: Capacity Management ===" << std::endl;
+
+    // Test 11.1: reserve and shrink_to_fit
+    {
+        std::cout << "Test 11.1: Reserve and shrink_to_fit... ";
+        List<int> list;
+        list.reserve(100);
+        assert(list.get_capacity() == 100);
+        for (int i = 0; i < 100; i++) {
+            list.add(i);
+        }
+        assert(list.get_capacity() == 100); // No reallocation after reserve
+
+        list.reserve(10); // Never shrinks
+        assert(list.get_capacity() == 100);
+
+        list.remove_at(0);
+        list.shrink_to_fit();
+        assert(list.get_capacity() == 99);
+        assert(list[0] == 1 && list[98] == 99);
+
+        list.clear();
+        list.shrink_to_fit();
+        assert(list.get_capacity() == 0);
+        list.add(5);
+        assert(list[0] == 5);
+
+        // Static lists cannot reserve past their buffer
+        int static_buffer[4];
+        List<int> static_list;
+        static_list.init_static(static_buffer, 4);
+        static_list.reserve(4);
+        bool caught_exception = false;
+        try {
+            static_list.reserve(5);
+        } catch (const std::runtime_error& e) {
+            caught_exception = true;
+        }
+        assert(caught_exception);
+        static_list.shrink_to_fit();
+        assert(static_list.get_capacity() == 4);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 11.2: Growth policies
+    {
+        std::cout << "Test 11.2: Growth policies... ";
+        List<int, std::allocator<int>, GrowthOneAndHalf> half(4);
+        for (int i = 0; i < 5; i++) {
+            half.add(i);
+        }
+        assert(half.get_capacity() == 7);
+
+        List<int, std::allocator<int>, GrowthFixed<10>> fixed(4);
+        for (int i = 0; i < 15; i++) {
+            fixed.add(i);
+        }
+        assert(fixed.get_capacity() == 24);
+
+        List<int, std::allocator<int>, GrowthPageRounded<>> paged;
+        paged.add(1);
+        assert(paged.get_capacity() == 4096 / sizeof(int));
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 11.3: Small lists shrink back into inline storage
+    {
+        std::cout << "Test 11.3: Small lists shrink back inline... ";
+        SmallList<std::string, 4> small;
+        for (int i = 0; i < 10; i++) {
+            small.add(std::to_string(i));
+        }
+        assert(!small.is_inline_storage());
+        for (int i = 0; i < 7; i++) {
+            small.remove_at(0);
+        }
+        small.shrink_to_fit();
+        assert(small.is_inline_storage());
+        assert(small.get_capacity() == 4);
+        assert(small.length() == 3 && small[0] == "7" && small[2] == "9");
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 12: Bulk Operations
+    std::cout << "\n=== Test Suite 12: Bulk Operations ===" << std::endl;
+
+    // Test 12.1: Append arrays and lists
+    {
+        std::cout << "Test 12.1: Append arrays and lists... ";
+        CountingAllocator<int>::Counters counters;
+        List<int, CountingAllocator<int>> list{CountingAllocator<int>(&counters)};
+        int batch[1000];
+        for (int i = 0; i < 1000; i++) {
+            batch[i] = i;
+        }
+        list.append(batch, 1000);
+        assert(counters.allocations == 1); // One growth for the whole batch
+        assert(list.length() == 1000 && list[999] == 999);
+
+        list.append(&list[0], list.length()); // Source aliases the list across a growth
+        assert(list.length() == 2000 && list[1000] == 0 && list[1999] == 999);
+
+        List<std::string> words;
+        words.add("a");
+        List<std::string> more;
+        more.add("b");
+        more.add("c");
+        words.append(std::move(more));
+        assert(words.length() == 3 && words[2] == "c");
+        assert(more.is_empty());
+
+        List<std::string> empty;
+        empty.append(std::move(words)); // Takes the buffer over
+        assert(empty.length() == 3 && words.is_empty());
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 12.2: Insert ranges
+    {
+        std::cout << "Test 12.2: Insert ranges... ";
+        List<int> numbers;
+        int head[] = {1, 2, 7, 8};
+        int middle[] = {3, 4, 5, 6};
+        numbers.append(head, 4);
+        numbers.insert_range(2, middle, middle + 4);
+        for (int i = 0; i < 8; i++) {
+            assert(numbers[i] == i + 1);
+        }
+
+        // Strings: range shorter and longer than the shifted tail
+        List<std::string> words;
+        std::string initial[] = {"a", "e", "f"};
+        words.append(initial, 3);
+        std::string short_range[] = {"b"};
+        words.insert_range(1, short_range, short_range + 1);
+        std::string long_range[] = {"c", "d", "x", "y"};
+        words.insert_range(3, long_range, long_range + 2);
+        words.insert_range(words.length(), long_range + 2, long_range + 4);
+        std::string expected[] = {"a", "b", "e", "c", "d", "f", "x", "y"};
+        assert(words.length() == 8);
+        for (size_t i = 0; i < 8; i++) {
+            assert(words[i] == expected[i]);
+        }
+        List<std::string> words2;
+        words2.append(initial, 3);
+        words2.insert_range(2, long_range, long_range + 4);
+        std::string expected2[] = {"a", "e", "c", "d", "x", "y", "f"};
+        for (size_t i = 0; i < 7; i++) {
+            assert(words2[i] == expected2[i]);
+        }
+
+#ifndef LIST_NO_CHECKS
+        bool caught_exception = false;
+        try {
+            numbers.insert_range(9, middle, middle + 1);
+        } catch (const std::out_of_range& e) {
+            caught_exception = true;
+        }
+        assert(caught_exception);
+#endif
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 12.3: Remove ranges
+    {
+        std::cout << "Test 12.3: Remove ranges... ";
+        List<std::string> words;
+        for (int i = 0; i < 10; i++) {
+            words.add(std::to_string(i));
+        }
+        words.remove_range(2, 5);
+        assert(words.length() == 7);
+        assert(words[1] == "1" && words[2] == "5" && words[6] == "9");
+        words.remove_range(3, 3);
+        assert(words.length() == 7);
+        words.remove_range(0, words.length());
+        assert(words.is_empty());
+
+#ifndef LIST_NO_CHECKS
+        bool caught_exception = false;
+        try {
+            words.remove_range(0, 1);
+        } catch (const std::out_of_range& e) {
+            caught_exception = true;
+        }
+        assert(caught_exception);
+#endif
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 13: Iteration and Raw Access
+    std::cout << "\n=== Test Suite 13: Iteration & Raw Access ===" << std::endl;
+
+    // Test 13.1: Range-for and standard algorithms
+    {
+        std::cout << "Test 13.1: Range-for and standard algorithms... ";
+        List<int> list;
+        for (int i = 10; i > 0; i--) {
+            list.add(i);
+        }
+        std::sort(list.begin(), list.end());
+        int expected = 1;
+        for (int value : list) {
+            assert(value == expected++);
+        }
+        assert(std::accumulate(list.cbegin(), list.cend(), 0) == 55);
+        assert(std::find(list.begin(), list.end(), 7) - list.begin() == 6);
+        assert(list.end() - list.begin() == 10);
+        assert(list.data() == &list[0]);
+
+        const List<int>& const_list = list;
+        long sum = 0;
+        for (const int& value : const_list) {
+            sum += value;
+        }
+        assert(sum == 55);
+
+        List<int> empty;
+        assert(empty.begin() == empty.end());
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 13.2: Checked and unchecked element access
+    {
+        std::cout << "Test 13.2: Checked and unchecked access... ";
+        List<int> list;
+        list.add(1);
+        list.add(2);
+        list.at(1) = 20;
+        list.at_unchecked(0) = 10;
+        assert(list[0] == 10 && list.at(1) == 20 && list.at_unchecked(1) == 20);
+
+#ifndef LIST_NO_CHECKS
+        bool caught_exception = false;
+        try {
+            list.at(2);
+        } catch (const std::out_of_range& e) {
+            caught_exception = true;
+        }
+        assert(caught_exception);
+#endif
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 14: Vectorized Search
+    std::cout << "\n=== Test Suite 14: Vectorized Search ===" << std::endl;
+
+    // Test 14.1: index_of, count_of and index_of_any agree on every instruction set
+    {
+        std::cout << "Test 14.1: Search kernels on every instruction set... ";
+        list_simd::Isa isas[] = {list_simd::Isa::scalar, list_simd::Isa::sse2, list_simd::Isa::avx2,
+                                 list_simd::Isa::avx512, list_simd::Isa::neon};
+        List<char> chars;
+        List<int16_t> shorts;
+        List<int32_t> ints;
+        List<uint64_t> longs;
+        List<float> floats;
+        List<double> doubles;
+        for (int i = 0; i < 1000; i++) {
+            chars.add(static_cast<char>(i % 100));
+            shorts.add(static_cast<int16_t>(i));
+            ints.add(i * 3);
+            longs.add(static_cast<uint64_t>(i) << 33);
+            floats.add(static_cast<float>(i) * 0.5f);
+            doubles.add(static_cast<double>(i) * 0.25);
+        }
+        floats.add(-0.0f);
+
+        for (list_simd::Isa isa : isas) {
+            list_simd::set_active_isa(isa);
+            for (int target : {0, 1, 15, 16, 17, 63, 64, 65, 500, 998, 999}) {
+                assert(shorts.index_of(static_cast<int16_t>(target)) == target);
+                assert(ints.index_of(target * 3) == target);
+                assert(longs.index_of(static_cast<uint64_t>(target) << 33) == target);
+                assert(floats.index_of(static_cast<float>(target) * 0.5f) == target);
+                assert(doubles.index_of(static_cast<double>(target) * 0.25) == target);
+            }
+            assert(chars.index_of(static_cast<char>(99)) == 99);
+            assert(ints.index_of(1) == -1);
+            assert(longs.index_of(1) == -1);
+            assert(floats.index_of(0.25f) == -1);
+            assert(floats.index_of(0.0f) == 0); // IEEE equality: -0.0 == 0.0
+            assert(!ints.contains(-3) && ints.contains(2997));
+
+            assert(chars.count_of(static_cast<char>(7)) == 10);
+            assert(ints.count_of(9) == 1);
+            assert(floats.count_of(0.0f) == 2);
+            assert(longs.count_of(7) == 0);
+
+            assert(ints.index_of_any(-1, 2997, 300) == 100);
+            assert(ints.index_of_any(1, 2) == -1);
+            assert(shorts.index_of_any(1, 2, 3, 4, 5, 6, 7, 8, 9, 0) == 0); // More keys than one pass
+            assert(shorts.index_of_any(900, 901, 902, 903, 904, 905, 906, 907, 908, 42) == 42);
+        }
+        list_simd::set_active_isa(list_simd::detect_isa());
+
+        List<std::string> words;
+        words.add("x");
+        words.add("y");
+        words.add("x");
+        assert(words.count_of("x") == 2);
+        assert(words.index_of_any("z", "y") == 1);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 15: Sorted Lists
+    std::cout << "\n=== Test Suite 15: Sorted Lists ===" << std::endl;
+
+    // Test 15.1: Sorted insert and binary search
+    {
+        std::cout << "Test 15.1: Sorted insert and binary search... ";
+        SortedList<int> sorted;
+        int values[] = {50, 10, 40, 20, 30, 20};
+        for (int value : values) {
+            sorted.insert_sorted(value);
+        }
+        int expected[] = {10, 20, 20, 30, 40, 50};
+        for (size_t i = 0; i < 6; i++) {
+            assert(sorted[i] == expected[i]);
+        }
+        assert(sorted.lower_bound(20) == 1);
+        assert(sorted.upper_bound(20) == 3);
+        assert(sorted.lower_bound(5) == 0);
+        assert(sorted.lower_bound(60) == 6);
+        assert(sorted.index_of(30) == 3);
+        assert(sorted.index_of(35) == -1);
+        assert(sorted.contains_sorted(50) && !sorted.contains_sorted(0));
+        assert(sorted.count_of(20) == 2);
+        assert(sorted.remove_value(20) == 2);
+        assert(sorted.length() == 4 && sorted[1] == 30);
+
+        // Exhaustive check against std::lower_bound for every size up to 64
+        for (int n = 0; n <= 64; n++) {
+            SortedList<int> evens;
+            for (int i = 0; i < n; i++) {
+                evens.insert_sorted(2 * i);
+            }
+            for (int probe = -1; probe <= 2 * n; probe++) {
+                size_t reference = static_cast<size_t>(std::lower_bound(evens.begin(), evens.end(), probe) - evens.begin());
+                assert(evens.lower_bound(probe) == reference);
+                size_t reference_upper = static_cast<size_t>(std::upper_bound(evens.begin(), evens.end(), probe) - evens.begin());
+                assert(evens.upper_bound(probe) == reference_upper);
+            }
+        }
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 15.2: Custom ordering, bulk build and merge
+    {
+        std::cout << "Test 15.2: Custom ordering, bulk build and merge... ";
+        List<std::string> raw;
+        raw.add("pear");
+        raw.add("apple");
+        raw.add("fig");
+        SortedList<std::string, std::greater<std::string>> words(std::move(raw));
+        assert(words[0] == "pear" && words[2] == "apple");
+
+        std::string batch[] = {"zucchini", "grape", "banana"};
+        words.merge_sorted(batch, 3);
+        std::string expected[] = {"zucchini", "pear", "grape", "fig", "banana", "apple"};
+        assert(words.length() == 6);
+        for (size_t i = 0; i < 6; i++) {
+            assert(words[i] == expected[i]);
+        }
+
+        SortedList<int> left;
+        SortedList<int> right;
+        for (int i = 0; i < 10; i++) {
+            left.insert_sorted(i * 2);
+            right.insert_sorted(i * 2 + 1);
+        }
+        left.merge_sorted(std::move(right));
+        assert(left.length() == 20 && right.is_empty());
+        for (int i = 0; i < 20; i++) {
+            assert(left[i] == i);
+        }
+
+        // Merging an rvalue list moves its elements instead of copying them
+        struct ByValue {
+            bool operator()(const Tracked& a, const Tracked& b) const {
+                return a.value < b.value;
+            }
+        };
+        SortedList<Tracked, ByValue> tracked;
+        SortedList<Tracked, ByValue> incoming;
+        for (int i = 0; i < 8; i++) {
+            tracked.insert_sorted(Tracked(i * 2));
+            incoming.insert_sorted(Tracked(i * 2 + 1));
+        }
+        Tracked::reset();
+        tracked.merge_sorted(std::move(incoming));
+        assert(Tracked::copies == 0 && tracked.length() == 16 && incoming.is_empty());
+        for (int i = 0; i < 16; i++) {
+            assert(tracked[i].value == i);
+        }
+
+        // A throwing assignment part-way through a merge leaves the list ordered
+        struct Fragile {
+            int value;
+            int* budget; ///< Copy assignments left before one throws
+
+            Fragile(int value, int* budget) : value(value), budget(budget) {}
+            Fragile(const Fragile&) = default;
+            Fragile& operator=(const Fragile& other) {
+                if ((*budget)-- == 0) {
+                    throw std::runtime_error("copy failed");
+                }
+                value = other.value;
+                return *this;
+            }
+            bool operator<(const Fragile& other) const {
+                return value < other.value;
+            }
+        };
+        int budget = 1000;
+        SortedList<Fragile> fragile;
+        for (int i = 0; i < 6; i++) {
+            fragile.insert_sorted(Fragile(i * 10, &budget));
+        }
+        Fragile more[] = {Fragile(5, &budget), Fragile(25, &budget), Fragile(45, &budget)};
+        budget = 2;
+        bool threw = false;
+        try {
+            fragile.merge_sorted(more, 3);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        budget = 1000;
+        assert(threw && fragile.length() == 9);
+        for (size_t i = 1; i < fragile.length(); i++) {
+            assert(!(fragile[i] < fragile[i - 1]));
+        }
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 16: Instrumentation
+    std::cout << "\n=== Test Suite 16: Instrumentation ===" << std::endl;
+
+    // Test 16.1: Growth, shift and search counters
+    {
+        std::cout << "Test 16.1: Growth, shift and search counters... ";
+        List<int, std::allocator<int>, GrowthDouble, CountingListStats> list;
+        for (int i = 0; i < 9; i++) {
+            list.add(i);
+        }
+        ListStatsSnapshot s = list.stats().snapshot();
+        assert(s.reallocations == 4); // 1 -> 2 -> 4 -> 8 -> 16
+        assert(s.elements_relocated == 1 + 2 + 4 + 8);
+        assert(s.allocations == 5);
+        assert(s.peak_capacity == 16);
+        assert(s.live_bytes == 16 * sizeof(int));
+
+        list.insert(0, -1);  // Shifts 9 elements
+        list.remove_at(8);   // Shifts 1 element
+        s = list.stats().snapshot();
+        assert(s.shifts == 2 && s.shift_distance == 10);
+
+        assert(list.index_of(2) == 3);
+        assert(list.index_of(100) == -1);
+        s = list.stats().snapshot();
+        assert(s.searches == 2 && s.search_probes == 4 + 9);
+
+        list.stats().reset();
+        s = list.stats().snapshot();
+        assert(s.reallocations == 0 && s.searches == 0 && s.live_bytes == 16 * sizeof(int));
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 16.2: Registry lists and dumps live instrumented lists
+    {
+        std::cout << "Test 16.2: Stats registry... ";
+        size_t before = ListStatsRegistry::instance().size();
+        {
+            List<int, std::allocator<int>, GrowthDouble, CountingListStats> queue;
+            queue.stats().set_label("test-queue");
+            queue.add(1);
+            queue.insert(0, 2);
+            assert(ListStatsRegistry::instance().size() == before + 1);
+
+            std::ostringstream out;
+            ListStatsRegistry::instance().dump(out);
+            assert(out.str().find("test-queue: allocations=") != std::string::npos);
+            assert(out.str().find("shifts=1") != std::string::npos);
+        }
+        assert(ListStatsRegistry::instance().size() == before);
+        assert(sizeof(List<int>) == sizeof(List<int, std::allocator<int>, GrowthDouble, NoListStats>));
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 16.3: Moves hand the live bytes over with the buffer
+    {
+        std::cout << "Test 16.3: Live bytes follow moved buffers... ";
+        using CountedList = List<int, std::allocator<int>, GrowthDouble, CountingListStats>;
+        CountedList a(16);
+        a.add(1);
+        a.add(2);
+        CountedList b(std::move(a));
+        assert(a.stats().snapshot().live_bytes == 0);
+        assert(b.stats().snapshot().live_bytes == 16 * sizeof(int));
+
+        b.shrink_to_fit();
+        assert(b.stats().snapshot().live_bytes == 2 * sizeof(int));
+
+        CountedList c(4);
+        c = std::move(b);
+        assert(b.stats().snapshot().live_bytes == 0);
+        assert(c.stats().snapshot().live_bytes == 2 * sizeof(int));
+
+        CountedList d;
+        d.append(std::move(c)); // Steals the buffer of the empty destination's source
+        assert(c.stats().snapshot().live_bytes == 0);
+        assert(d.stats().snapshot().live_bytes == 2 * sizeof(int) && d.length() == 2);
+        d.shrink_to_fit();
+        d.clear();
+        d.shrink_to_fit();
+        assert(d.stats().snapshot().live_bytes == 0);
+
+        using CountedFlags = List<bool, std::allocator<bool>, GrowthDouble, CountingListStats>;
+        CountedFlags flags(128);
+        flags.add(true);
+        CountedFlags moved_flags(std::move(flags));
+        assert(flags.stats().snapshot().live_bytes == 0);
+        assert(moved_flags.stats().snapshot().live_bytes == 2 * sizeof(uint64_t));
+        moved_flags.shrink_to_fit();
+        assert(moved_flags.stats().snapshot().live_bytes == sizeof(uint64_t));
+        CountedFlags assigned_flags;
+        assigned_flags = std::move(moved_flags);
+        assert(moved_flags.stats().snapshot().live_bytes == 0);
+        assert(assigned_flags.stats().snapshot().live_bytes == sizeof(uint64_t) && assigned_flags[0]);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 17: Unordered Removal and Ring Lists
+    std::cout << "\n=== Test Suite 17: Unordered Removal and Ring Lists ===" << std::endl;
+
+    // Test 17.1: swap_remove fills the hole with the last element
+    {
+        std::cout << "Test 17.1: swap_remove... ";
+        List<std::string> list;
+        list.add("a");
+        list.add("b");
+        list.add("c");
+        list.add("d");
+        list.swap_remove(1);
+        assert(list.length() == 3 && list[0] == "a" && list[1] == "d" && list[2] == "c");
+        list.swap_remove(2); // Removing the last element moves nothing
+        assert(list.length() == 2 && list[1] == "d");
+
+#ifndef LIST_NO_CHECKS
+        bool caught = false;
+        try {
+            list.swap_remove(2);
+        } catch (const std::out_of_range&) {
+            caught = true;
+        }
+        assert(caught);
+#endif
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 17.2: Ring pushes and pops at both ends, wrapping and growing
+    {
+        std::cout << "Test 17.2: Ring push/pop at both ends... ";
+        RingList<std::string> ring(4);
+        ring.push_back("c");
+        ring.push_front("b");
+        ring.push_front("a"); // Wraps to the end of the buffer
+        ring.push_back("d");
+        assert(ring.length() == 4 && ring.get_capacity() == 4);
+        ring.push_front("z"); // Full: grows and unwraps
+        assert(ring.get_capacity() == 8);
+        const char* expected[] = {"z", "a", "b", "c", "d"};
+        for (size_t i = 0; i < 5; i++) {
+            assert(ring[i] == expected[i]);
+        }
+
+        assert(ring.pop_front() == "z");
+        assert(ring.pop_back() == "d");
+        assert(ring.front() == "a" && ring.back() == "c" && ring.at(1) == "b");
+
+#ifndef LIST_NO_CHECKS
+        bool caught = false;
+        try {
+            ring.at(3);
+        } catch (const std::out_of_range&) {
+            caught = true;
+        }
+        assert(caught);
+#endif
+
+        ring.clear();
+#ifndef LIST_NO_CHECKS
+        caught = false;
+        try {
+            ring.pop_front();
+        } catch (const std::out_of_range&) {
+            caught = true;
+        }
+        assert(caught && ring.is_empty());
+#endif
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 17.3: Draining a large backlog from the front stays linear
+    {
+        std::cout << "Test 17.3: Ring as a work queue... ";
+        RingList<int> queue;
+        const int n = 500000;
+        for (int i = 0; i < n; i++) {
+            queue.push_back(i);
+        }
+        long long sum = 0;
+        for (int round = 0; round < n; round++) {
+            int item = queue.pop_front();
+            sum += item;
+            if (round % 4 == 0) {
+                queue.push_back(item); // Requeue some work so the ring wraps
+            }
+        }
+        assert(queue.length() == n / 4);
+        assert(sum > 0);
+
+        RingList<int> moved = std::move(queue);
+        assert(moved.length() == n / 4 && queue.is_empty());
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 18: Concurrent Lists
+    std::cout << "\n=== Test Suite 18: Concurrent Lists ===" << std::endl;
+
+    // Test 18.1: Lock-free add from many threads while readers index published elements
+    {
+        std::cout << "Test 18.1: ConcurrentList parallel add... ";
+        ConcurrentList<long, std::allocator<long>, 4> list;
+        const int writers = 4;
+        const long per_writer = 20000;
+        std::atomic<bool> done{false};
+        std::atomic<long> seen{0};
+
+        std::thread reader([&]() {
+            while (!done.load()) {
+                size_t n = list.length();
+                for (size_t i = 0; i < n; i++) {
+                    if (const long* value = list.try_get(i)) {
+                        assert(*value >= 0 && *value < writers * per_writer);
+                        seen.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+        std::vector<std::thread> threads;
+        for (int w = 0; w < writers; w++) {
+            threads.emplace_back([&list, w, per_writer]() {
+                for (long i = 0; i < per_writer; i++) {
+                    list.add(w * per_writer + i);
+                }
+            });
+        }
+        for (std::thread& t : threads) {
+            t.join();
+        }
+        done.store(true);
+        reader.join();
+
+        assert(list.length() == static_cast<size_t>(writers * per_writer));
+        std::vector<bool> present(writers * per_writer, false);
+        for (size_t i = 0; i < list.length(); i++) {
+            assert(list.is_published(i));
+            present[list.at(i)] = true;
+        }
+        assert(std::all_of(present.begin(), present.end(), [](bool p) { return p; }));
+        assert(list.try_get(list.length()) == nullptr);
+
+        const long* first = &list.at(0);
+        list.add(-1);
+        assert(first == &list.at(0)); // Elements never move
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 18.2: SPSC ring over a caller buffer
+    {
+        std::cout << "Test 18.2: SPSC ring... ";
+        std::string buffer[8];
+        SpscRing<std::string> ring;
+        ring.init_static(buffer, 8);
+        for (int i = 0; i < 8; i++) {
+            assert(ring.try_push(std::to_string(i)));
+        }
+        assert(!ring.try_push("full"));
+        std::string out;
+        assert(ring.try_pop(out) && out == "0");
+        assert(ring.length() == 7);
+
+        SpscRing<int> numbers;
+        int storage[64];
+        numbers.init_static(storage, 64);
+        const int n = 200000;
+        std::thread producer([&]() {
+            for (int i = 0; i < n; i++) {
+                while (!numbers.try_push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        long long sum = 0;
+        int expected_next = 0;
+        for (int received = 0; received < n;) {
+            int value;
+            if (numbers.try_pop(value)) {
+                assert(value == expected_next++); // FIFO order
+                sum += value;
+                received++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        assert(sum == static_cast<long long>(n) * (n - 1) / 2);
+
+        bool caught = false;
+        try {
+            numbers.init_static(storage, 48);
+        } catch (const std::invalid_argument&) {
+            caught = true;
+        }
+        assert(caught);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 18.3: MPMC ring with several producers and consumers
+    {
+        std::cout << "Test 18.3: MPMC ring... ";
+        int storage[128];
+        MpmcRing<int> ring;
+        ring.init_static(storage, 128);
+        const int producers = 3;
+        const int consumers = 3;
+        const int per_producer = 50000;
+        std::atomic<long long> sum{0};
+        std::atomic<int> consumed{0};
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++) {
+            threads.emplace_back([&ring, p, per_producer]() {
+                for (int i = 0; i < per_producer; i++) {
+                    while (!ring.try_push(p * per_producer + i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (int c = 0; c < consumers; c++) {
+            threads.emplace_back([&]() {
+                int value;
+                while (consumed.load() < producers * per_producer) {
+                    if (ring.try_pop(value)) {
+                        sum.fetch_add(value);
+                        consumed.fetch_add(1);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (std::thread& t : threads) {
+            t.join();
+        }
+        long long total = static_cast<long long>(producers) * per_producer;
+        assert(consumed.load() == total && sum.load() == total * (total - 1) / 2);
+        int value;
+        assert(!ring.try_pop(value));
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 19: Parallel Algorithms
+    std::cout << "\n=== Test Suite 19: Parallel Algorithms ===" << std::endl;
+
+    // Test 19.1: for_each, transform and reduce across a pool
+    {
+        std::cout << "Test 19.1: Parallel for_each, transform and reduce... ";
+        list_parallel::ThreadPool pool(3);
+        list_parallel::ParallelOptions options{1000, &pool};
+        List<long> list;
+        for (long i = 0; i < 100000; i++) {
+            list.add(i);
+        }
+
+        list_parallel::parallel_for_each(list, [](long& v) { v *= 2; }, options);
+        assert(list[99999] == 199998);
+
+        List<double> halves;
+        halves.add(-1.0); // Replaced by the transform
+        list_parallel::parallel_transform(list, halves, [](long v) { return v / 2.0; }, options);
+        assert(halves.length() == list.length() && halves[12345] == 12345.0);
+
+        long sum = list_parallel::parallel_reduce(list, 0L, std::plus<>(), options);
+        assert(sum == 99999L * 100000L);
+
+        // Non-commutative but associative: concatenation keeps chunk order
+        List<std::string> letters;
+        for (int i = 0; i < 26 * 40; i++) {
+            letters.add(std::string(1, static_cast<char>('a' + i % 26)));
+        }
+        std::string joined = list_parallel::parallel_reduce(letters, std::string(), std::plus<>(),
+                                                             list_parallel::ParallelOptions{7, &pool});
+        std::string expected;
+        for (size_t i = 0; i < letters.length(); i++) {
+            expected += letters[i];
+        }
+        assert(joined == expected);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 19.2: find returns the lowest matching index
+    {
+        std::cout << "Test 19.2: Parallel find with early exit... ";
+        list_parallel::ThreadPool pool(3);
+        list_parallel::ParallelOptions options{512, &pool};
+        List<int> list;
+        for (int i = 0; i < 200000; i++) {
+            list.add(i % 50000);
+        }
+        assert(list_parallel::parallel_find(list, 42000, options) == 42000);
+        assert(list_parallel::parallel_find(list, -5, options) == -1);
+        assert(list_parallel::parallel_find_if(list, [](int v) { return v > 49990; }, options) == 49991);
+
+        List<int> empty;
+        assert(list_parallel::parallel_find(empty, 1, options) == -1);
+        assert(list_parallel::parallel_reduce(empty, 7, std::plus<>(), options) == 7);
+
+        bool caught = false;
+        try {
+            list_parallel::parallel_for_each(list, [](int& v) {
+                if (v == 1234) {
+                    throw std::runtime_error("stop");
+                }
+            }, options);
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        assert(caught);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 19.3: Parallel sort, including with execution policies
+    {
+        std::cout << "Test 19.3: Parallel sort... ";
+        list_parallel::ThreadPool pool(3);
+        List<unsigned> list;
+        unsigned state = 12345;
+        for (int i = 0; i < 100003; i++) {
+            state = state * 1103515245u + 12345u;
+            list.add(state >> 8);
+        }
+        List<unsigned> copy;
+        copy.append(list.data(), list.length());
+
+        list_parallel::parallel_sort(list, std::less<unsigned>(), list_parallel::ParallelOptions{1000, &pool});
+        std::sort(copy.begin(), copy.end());
+        assert(std::equal(list.begin(), list.end(), copy.begin()));
+
+        list_parallel::parallel_sort(list, std::greater<unsigned>(), list_parallel::ParallelOptions{333, &pool});
+        assert(std::is_sorted(list.begin(), list.end(), std::greater<unsigned>()));
+
+#if defined(__cpp_lib_execution)
+        list_parallel::parallel_sort(std::execution::par, list);
+        assert(std::equal(list.begin(), list.end(), copy.begin()));
+        assert(list_parallel::parallel_find(std::execution::seq, list, copy[500]) >= 0);
+#endif
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 20: Structure-of-Arrays Lists
+    std::cout << "\n=== Test Suite 20: Structure-of-Arrays Lists ===" << std::endl;
+
+    // Test 20.1: Rows go into separate aligned columns
+    {
+        std::cout << "Test 20.1: Columns and row proxies... ";
+        SoAList<int, double, std::string> trades;
+        for (int i = 0; i < 100; i++) {
+            trades.add(i, i * 0.5, "t" + std::to_string(i));
+        }
+        assert(trades.length() == 100 && trades.get_capacity() >= 100);
+
+        auto ids = trades.column<0>();
+        auto prices = trades.column<1>();
+        assert(ids.length() == 100 && ids[42] == 42);
+        assert(reinterpret_cast<uintptr_t>(ids.data()) % SoAList<int>::column_alignment == 0);
+        assert(reinterpret_cast<uintptr_t>(prices.data()) % SoAList<int>::column_alignment == 0);
+        assert(reinterpret_cast<uintptr_t>(trades.column<2>().data()) % SoAList<int>::column_alignment == 0);
+        double total = std::accumulate(prices.begin(), prices.end(), 0.0);
+        assert(total == 0.5 * 99 * 100 / 2);
+
+        auto [id, price, name] = trades[7];
+        assert(id == 7 && price == 3.5 && name == "t7");
+        price = 100.0; // Row proxies refer into the columns
+        assert(trades.field<1>(7) == 100.0);
+
+        size_t rows = 0;
+        for (auto row : trades) {
+            assert(std::get<0>(row) == static_cast<int>(rows));
+            rows++;
+        }
+        assert(rows == 100);
+
+#ifndef LIST_NO_CHECKS
+        bool caught = false;
+        try {
+            trades.at(100);
+        } catch (const std::out_of_range&) {
+            caught = true;
+        }
+        assert(caught);
+#endif
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 20.2: Removal, moves and static columns
+    {
+        std::cout << "Test 20.2: Removal, moves and static columns... ";
+        SoAList<int, std::string> list(2);
+        list.add(1, "one");
+        list.add(2, "two");
+        list.add(3, std::get<1>(list[0])); // Grows while the argument refers into the list
+        assert(list.length() == 3 && list.field<1>(2) == "one");
+
+        list.remove_at(0);
+        assert(list.field<0>(0) == 2 && list.field<1>(1) == "one");
+        list.add(4, "four");
+        list.swap_remove(0);
+        assert(list.length() == 2 && list.field<0>(0) == 4 && list.field<1>(0) == "four");
+
+        SoAList<int, std::string> moved = std::move(list);
+        assert(moved.length() == 2 && list.is_empty());
+
+        int keys[2];
+        float weights[2];
+        SoAList<int, float> fixed;
+        fixed.init_static(2, keys, weights);
+        fixed.add(1, 1.5f);
+        fixed.add(2, 2.5f);
+        assert(keys[1] == 2 && weights[0] == 1.5f && !fixed.is_dynamic_allocation());
+        bool caught = false;
+        try {
+            fixed.add(3, 3.5f);
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        assert(caught && fixed.length() == 2);
+
+        // A capacity whose column sizes overflow size_t is rejected before allocating
+        SoAList<uint64_t, uint32_t> huge;
+        caught = false;
+        try {
+            huge.reserve(size_t(1) << 62);
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        assert(caught && huge.get_capacity() == 0);
+        huge.add(1, 2);
+        assert(huge.length() == 1 && huge.field<1>(0) == 2);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+#if LIST_HAS_MMAP
+    // Test suite 21: Memory-Mapped Lists
+    std::cout << "\n=== Test Suite 21: Memory-Mapped Lists ===" << std::endl;
+
+    // Test 21.1: Elements survive reopening the file
+    {
+        std::cout << "Test 21.1: Persist, grow and reopen... ";
+        const char* path = "list_mapped_test.bin";
+        std::remove(path);
+        {
+            MappedList<uint64_t> ids(path, MapMode::read_write, 4);
+            for (uint64_t i = 0; i < 5000; i++) {
+                ids.add(i * 3);
+            }
+            ids.add(ids[10]); // Argument lives in the mapping
+            uint64_t batch[3] = {7, 8, 9};
+            ids.append(batch, 3);
+            ids.remove_at(0);
+            assert(ids.length() == 5003 && ids.get_capacity() >= 5003);
+            ids.sync();
+        }
+        {
+            MappedList<uint64_t> ids(path, MapMode::read_only);
+            assert(ids.is_read_only() && ids.length() == 5003);
+            assert(ids[0] == 3 && ids.at(4998) == 4999 * 3 && ids[4999] == 30 && ids[5002] == 9);
+
+            bool caught = false;
+            try {
+                ids.add(1);
+            } catch (const std::runtime_error&) {
+                caught = true;
+            }
+            assert(caught);
+        }
+        {
+            MappedList<uint64_t> ids(path);
+            ids.set_element(0, 42);
+            MappedList<uint64_t> moved = std::move(ids);
+            assert(moved.length() == 5003 && moved[0] == 42 && ids.length() == 0);
+            bool caught = false;
+            try {
+                ids.add(1);
+            } catch (const std::runtime_error&) {
+                caught = true;
+            }
+            assert(caught && ids.get_capacity() == 0);
+        }
+        std::remove(path);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 21.2: Files are checked against the element type
+    {
+        std::cout << "Test 21.2: Header validation... ";
+        const char* path = "list_mapped_test.bin";
+        std::remove(path);
+        {
+            MappedList<uint32_t> values(path);
+            values.add(1);
+        }
+        bool caught = false;
+        try {
+            MappedList<float> wrong(path, MapMode::read_only);
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        assert(caught);
+
+        // A capacity whose byte size wraps around must not pass as fitting in the file
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            uint64_t capacity = ~uint64_t(0) / sizeof(uint32_t) + 2;
+            file.seekp(offsetof(MappedListHeader, capacity));
+            file.write(reinterpret_cast<const char*>(&capacity), sizeof(capacity));
+        }
+        caught = false;
+        try {
+            MappedList<uint32_t> hostile(path, MapMode::read_only);
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        assert(caught);
+        std::remove(path);
+
+        caught = false;
+        try {
+            MappedList<uint32_t> missing(path, MapMode::read_only);
+        } catch (const std::system_error&) {
+            caught = true;
+        }
+        assert(caught);
+
+        std::cout << "PASSED" << std::endl;
+    }
+#endif
+
+    // Test suite 22: Binary Serialization
+    std::cout << "\n=== Test Suite 22: Binary Serialization ===" << std::endl;
+
+    // Test 22.1: Stream round trip, whole and chunked
+    {
+        std::cout << "Test 22.1: Stream round trip... ";
+        List<uint32_t> list;
+        for (uint32_t i = 0; i < 10000; i++) {
+            list.add(i * 7);
+        }
+        std::stringstream whole;
+        write_to(list, whole);
+        assert(whole.str().size() == serialized_size(list));
+        std::stringstream chunked;
+        write_to(list, chunked, 333);
+        assert(chunked.str() == whole.str());
+
+        List<uint32_t> restored;
+        restored.add(99);
+        assert(read_from(restored, whole) == 10000);
+        assert(restored.length() == 10001 && restored[0] == 99 && restored[10000] == 9999 * 7);
+
+        std::stringstream truncated(whole.str().substr(0, 100));
+        whole.clear();
+        whole.seekg(0);
+        bool caught = false;
+        try {
+            read_from(restored, truncated);
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        assert(caught && restored.length() == 10001);
+
+        List<uint64_t> wrong;
+        caught = false;
+        try {
+            read_from(wrong, whole);
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        assert(caught && wrong.is_empty());
+
+        // Corrupt counts are rejected before anything is allocated
+        for (uint64_t count : {uint64_t(1) << 40, ~uint64_t(0)}) {
+            ListBlobHeader header{ListBlobHeader::expected_magic, sizeof(uint32_t), count};
+            std::stringstream hostile(std::string(reinterpret_cast<const char*>(&header), sizeof(header)) + "abcd");
+            List<uint32_t> target;
+            caught = false;
+            try {
+                read_from(target, hostile);
+            } catch (const std::runtime_error&) {
+                caught = true;
+            }
+            assert(caught && target.is_empty() && target.get_capacity() == 0);
+        }
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+#if LIST_HAS_FD_IO
+    // Test 22.2: File descriptor round trip through a pipe
+    {
+        std::cout << "Test 22.2: File descriptor round trip... ";
+        int fds[2];
+        assert(pipe(fds) == 0);
+        List<int16_t> list;
+        for (int i = 0; i < 1000; i++) {
+            list.add(static_cast<int16_t>(i - 500));
+        }
+        write_to(list, fds[1], 100);
+        write_to(list, fds[1]);
+        close(fds[1]);
+
+        List<int16_t> restored;
+        assert(read_from(restored, fds[0]) == 1000);
+        assert(read_from(restored, fds[0]) == 1000);
+        assert(restored.length() == 2000 && restored[0] == -500 && restored[1999] == 499);
+        bool caught = false;
+        try {
+            read_from(restored, fds[0]); // End of data
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        assert(caught);
+        close(fds[0]);
+
+        // Through a pipe the size is unknown, so a corrupt count only grows the list as far as
+        // the data actually delivered
+        assert(pipe(fds) == 0);
+        ListBlobHeader header{ListBlobHeader::expected_magic, sizeof(int16_t), uint64_t(1) << 40};
+        assert(write(fds[1], &header, sizeof(header)) == static_cast<ssize_t>(sizeof(header)));
+        assert(write(fds[1], restored.data(), 64) == 64);
+        close(fds[1]);
+        caught = false;
+        try {
+            read_from(restored, fds[0]);
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        assert(caught && restored.length() == 2000 && restored.get_capacity() < (size_t(1) << 22));
+        close(fds[0]);
+
+        std::cout << "PASSED" << std::endl;
+    }
+#endif
+
+    // Test 22.3: Adopting a received buffer, and text output
+    {
+        std::cout << "Test 22.3: Zero-copy adoption and operator<<... ";
+        List<double> list;
+        list.add(1.5);
+        list.add(-2.0);
+        std::stringstream out;
+        write_to(list, out);
+        std::string bytes = out.str();
+
+        alignas(16) char frame[64];
+        std::memcpy(frame, bytes.data(), bytes.size());
+        List<double> view;
+        adopt_buffer(view, frame, bytes.size());
+        assert(view.length() == 2 && !view.is_dynamic_allocation());
+        assert(view.data() == reinterpret_cast<double*>(frame + sizeof(ListBlobHeader)));
+        assert(view[1] == -2.0);
+
+        bool caught = false;
+        try {
+            adopt_buffer(view, frame, bytes.size() - 1);
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        assert(caught);
+
+        std::ostringstream text;
+        text << list;
+        assert(text.str() == "List (count: 2, capacity: 2): [1.5, -2]");
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test suite 23: List Views
+    std::cout << "\n=== Test Suite 23: List Views ===" << std::endl;
+
+    // Test 23.1: Slicing shares the list's storage
+    {
+        std::cout << "Test 23.1: Slices and subviews... ";
+        List<int> list;
+        for (int i = 0; i < 100; i++) {
+            list.add(i);
+        }
+        ListView<int> shard = list.slice(20, 30);
+        assert(shard.length() == 10 && shard.data() == list.data() + 20 && shard[0] == 20);
+        for (int& v : shard) {
+            v = -v;
+        }
+        assert(list[25] == -25 && list[30] == 30);
+
+        ListView<int> inner = shard.subview(2, 3);
+        assert(inner.length() == 3 && inner.at(0) == -22);
+        assert(shard.subview(8).length() == 2 && shard.subview(10).is_empty());
+
+        ListView<const int> whole = list; // Implicit conversion from a List
+        ListView<const int> read_only = shard;
+        assert(whole.length() == 100 && read_only[1] == -21);
+
+#ifndef LIST_NO_CHECKS
+        bool caught = false;
+        try {
+            list.slice(50, 101);
+        } catch (const std::out_of_range&) {
+            caught = true;
+        }
+        assert(caught);
+        caught = false;
+        try {
+            shard.subview(11);
+        } catch (const std::out_of_range&) {
+            caught = true;
+        }
+        assert(caught);
+#endif
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 23.2: Search functions work on views
+    {
+        std::cout << "Test 23.2: Searching views... ";
+        List<int> list;
+        for (int i = 0; i < 1000; i++) {
+            list.add(i % 100);
+        }
+        ListView<const int> second = list.slice(100, 200);
+        assert(second.index_of(42) == 42 && second.count_of(7) == 1);
+        assert(second.contains(99) && !list.slice(0, 50).contains(75));
+        assert(second.index_of_any(500, 3) == 3);
+
+        SortedList<int> sorted;
+        for (int i = 0; i < 50; i++) {
+            sorted.insert_sorted(i * 2);
+        }
+        ListView<const int> evens = sorted.view();
+        assert(evens.lower_bound(31) == 16 && evens.upper_bound(32) == 17);
+        assert(evens.contains_sorted(48) && !evens.contains_sorted(49));
+        assert(evens.slice(10, 20).lower_bound(25) == 3);
+
+        List<int> descending;
+        for (int i = 10; i > 0; i--) {
+            descending.add(i);
+        }
+        assert(descending.view().lower_bound(4, std::greater<int>()) == 6);
+
+        std::cout << "PASSED" << std::endl;
+    }
+
+    std::cout << "\n=== Test Suite 24: Static Lists ===" << std::endl;
+
+    // Test 24.1: Tables built at compile time are usable at run time
+    {
+        std::cout << "Test 24.1: Compile-time tables... ";
+        StaticList<int, 10> primes = prime_table;
+        assert(primes.index_of(23) == 8 && primes.index_of(24) == -1);
+        assert(prime_table.count_of(2) == 1 && prime_table.at(0) == 2);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 24.2: Run-time manipulation and bounds handling
+    {
+        std::cout << "Test 24.2: Run-time operations... ";
+        StaticList<std::string, 4> names;
+        names.add("b");
+        names.add(std::string("d"));
+        names.insert(0, "a");
+        names.insert(2, "c");
+        assert(names.is_full() && names[0] == "a" && names[3] == "d");
+
+        bool threw = false;
+        try {
+            names.add("e");
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw && names.length() == 4);
+
+        names.remove_at(1);
+        assert(names.length() == 3 && names[1] == "c" && names.index_of("d") == 2);
+
+#ifndef LIST_NO_CHECKS
+        threw = false;
+        try {
+            names.at(3);
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw);
+#endif
+
+        StaticList<std::string, 4> copy = names;
+        names.clear();
+        assert(names.is_empty() && copy.length() == 3 && copy[0] == "a");
+
+        ListView<const std::string> view = copy;
+        assert(view.length() == 3 && view[2] == "d");
+        std::cout << "PASSED" << std::endl;
+    }
+
+    std::cout << "\n=== Test Suite 25: Shared Copy-on-Write Lists ===" << std::endl;
+
+    // Test 25.1: Snapshots are unaffected by later writes
+    {
+        std::cout << "Test 25.1: Snapshot isolation... ";
+        SharedList<std::string> shared;
+        shared.add("a");
+        shared.add("b");
+        ListSnapshot<std::string> before = shared.snapshot();
+
+        shared.set_element(0, "z");
+        shared.remove_at(1);
+        shared.update([](List<std::string>& items) {
+            items.add("c");
+            items.add("d");
+        });
+        assert(before.length() == 2 && before[0] == "a" && before[1] == "b");
+
+        ListSnapshot<std::string> after = shared.snapshot();
+        assert(after.length() == 3 && after[0] == "z" && after.index_of("d") == 2);
+        assert(after.version_number() == shared.version_number() && after.version_number() > before.version_number());
+
+#ifndef LIST_NO_CHECKS
+        bool threw = false;
+        uint64_t version = shared.version_number();
+        try {
+            shared.set_element(10, "x");
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw && shared.version_number() == version);
+#endif
+
+        assert(!shared.refresh(after));
+        shared.clear();
+        assert(shared.refresh(after) && after.is_empty() && before.length() == 2);
+
+        ListSnapshot<std::string> none;
+        assert(none.is_empty() && none.version_number() == 0);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 25.2: Seeding from a List moves its elements
+    {
+        std::cout << "Test 25.2: Seeding from a List... ";
+        List<std::string> seed;
+        seed.add("alpha");
+        seed.add("beta");
+        const std::string* buffer = seed.data();
+        SharedList<std::string> shared(std::move(seed));
+        ListSnapshot<std::string> snap = shared.snapshot();
+        assert(seed.is_empty() && snap.length() == 2 && snap.data() == buffer && snap[1] == "beta");
+
+        List<std::string, std::allocator<std::string>, GrowthOneAndHalf> other;
+        other.add("gamma");
+        SharedList<std::string> converted(std::move(other));
+        assert(other.is_empty() && converted.snapshot()[0] == "gamma");
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 25.3: Readers always see a complete version while a writer publishes
+    {
+        std::cout << "Test 25.3: Concurrent readers and writer... ";
+        List<int> seed;
+        seed.add(0);
+        SharedList<int> shared(std::move(seed));
+        std::atomic<bool> done{false};
+        std::atomic<bool> consistent{true};
+
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 4; r++) {
+            readers.emplace_back([&] {
+                ListSnapshot<int> snap = shared.snapshot();
+                while (!done.load()) {
+                    shared.refresh(snap);
+                    for (size_t i = 0; i < snap.length(); i++) {
+                        if (snap[i] != static_cast<int>(i)) {
+                            consistent = false;
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+            });
+        }
+        for (int i = 1; i < 200; i++) {
+            shared.add(i);
+            std::this_thread::yield();
+        }
+        done = true;
+        for (std::thread& reader : readers) {
+            reader.join();
+        }
+        assert(consistent.load() && shared.length() == 200);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    std::cout << "\n=== Test Suite 26: Aligned and Hugepage Storage ===" << std::endl;
+
+    // Test 26.1: Aligned buffers stay aligned across growth
+    {
+        std::cout << "Test 26.1: Aligned allocator... ";
+        List<float, AlignedAllocator<float, 64>> floats;
+        for (int i = 0; i < 1000; i++) {
+            floats.add(static_cast<float>(i));
+            assert(reinterpret_cast<uintptr_t>(floats.data()) % 64 == 0);
+        }
+        assert(floats.index_of(999.0f) == 999);
+
+        List<char, AlignedAllocator<char, 4096>> paged(10);
+        assert(reinterpret_cast<uintptr_t>(paged.data()) % 4096 == 0);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 26.2: Large buffers are mapped on 2 MiB boundaries
+    {
+        std::cout << "Test 26.2: Hugepage allocator... ";
+        HugePageOptions options;
+        options.threshold = 1 << 20;
+        options.numa_node = 0;
+        List<int, HugePageAllocator<int>, GrowthPageRounded<GrowthDouble, 2 << 20>> big{HugePageAllocator<int>(options)};
+        for (int i = 0; i < 100; i++) {
+            big.add(i);
+        }
+        assert(reinterpret_cast<uintptr_t>(big.data()) % 64 == 0);
+
+        for (int i = 100; i < 600000; i++) {
+            big.add(i);
+        }
+#if LIST_HAS_MMAP
+        assert(reinterpret_cast<uintptr_t>(big.data()) % (2 << 20) == 0);
+#endif
+        assert(big.length() == 600000 && big[599999] == 599999 && big.index_of(123456) == 123456);
+        assert(big.get_allocator().get_options().threshold == (1 << 20));
+
+        bool threw = false;
+        try {
+            big.get_allocator().allocate((static_cast<size_t>(-1) - list_detail::huge_page_size) / sizeof(int) + 1);
+        } catch (const std::bad_array_new_length&) {
+            threw = true;
+        }
+        assert(threw);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    std::cout << "\n=== Test Suite 27: Chunked Lists ===" << std::endl;
+
+    // Test 27.1: Growth adds blocks and never moves elements
+    {
+        std::cout << "Test 27.1: Stable addresses... ";
+        ChunkedList<int, std::allocator<int>, 4> chunked;
+        chunked.add(0);
+        int* first = chunked.get_element(0);
+        std::vector<int*> addresses;
+        for (int i = 1; i < 1000; i++) {
+            chunked.add(i);
+            addresses.push_back(chunked.get_element(static_cast<size_t>(i)));
+        }
+        assert(chunked.get_element(0) == first && *first == 0);
+        for (int i = 1; i < 1000; i++) {
+            assert(addresses[static_cast<size_t>(i - 1)] == chunked.get_element(static_cast<size_t>(i)));
+            assert(chunked[static_cast<size_t>(i)] == i);
+        }
+        assert(chunked.block_number() == 8 && chunked.get_capacity() == 1020);
+
+        size_t runs = 0, total = 0;
+        chunked.for_each_block([&](const int* block, size_t n) {
+            assert(block[0] == static_cast<int>(total));
+            runs++;
+            total += n;
+        });
+        assert(runs == 8 && total == 1000);
+
+#ifndef LIST_NO_CHECKS
+        bool threw = false;
+        try {
+            chunked.at(1000);
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw);
+#endif
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 27.2: Searching, removal and iteration across blocks
+    {
+        std::cout << "Test 27.2: Search and removal... ";
+        ChunkedList<std::string, std::allocator<std::string>, 2> words;
+        for (int i = 0; i < 50; i++) {
+            words.add(std::to_string(i));
+        }
+        assert(words.index_of("37") == 37 && words.count_of("5") == 1 && !words.contains("50"));
+
+        words.remove_at(0);
+        assert(words.length() == 49 && words[0] == "1" && words[48] == "49");
+        words.swap_remove(0);
+        assert(words[0] == "49" && words.length() == 48);
+        words.remove_last();
+        assert(words.back() == "47");
+
+        std::sort(words.begin(), words.end());
+        assert(std::is_sorted(words.begin(), words.end()) && words.end() - words.begin() == 47);
+        const auto& readonly = words;
+        ChunkedList<std::string, std::allocator<std::string>, 2>::const_iterator it = words.begin();
+        assert(it == readonly.begin() && *(it + 46) == readonly.back());
+
+        ChunkedList<std::string, std::allocator<std::string>, 2> moved(std::move(words));
+        assert(words.is_empty() && moved.length() == 47);
+        moved.clear();
+        assert(moved.is_empty() && moved.get_capacity() > 0);
+
+        ChunkedList<int> ints;
+        for (int i = 0; i < 200; i++) {
+            ints.add(i % 10);
+        }
+        assert(ints.count_of(3) == 20 && ints.index_of(9) == 9);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    std::cout << "\n=== Test Suite 28: Incremental Growth ===" << std::endl;
+
+    // Test 28.1: Growth leaves elements behind and later adds migrate them
+    {
+        std::cout << "Test 28.1: Incremental migration... ";
+        IncrementalList<std::string, std::allocator<std::string>, GrowthDouble, 2> list;
+        for (int i = 0; i < 16; i++) {
+            list.add(std::to_string(i));
+        }
+        assert(!list.migration_pending() && list.get_capacity() == 16);
+
+        list.add("16"); // Grows to 32 and migrates only the first two elements
+        assert(list.migration_pending() && list.get_capacity() == 32 && list.migration_remaining() == 14);
+        for (int i = 0; i <= 16; i++) {
+            assert(list[static_cast<size_t>(i)] == std::to_string(i));
+        }
+        assert(list.index_of("9") == 9 && list.index_of("16") == 16 && list.index_of("0") == 0);
+
+        list.set_element(10, "ten");
+        list.add("17");
+        assert(list.migration_remaining() == 12 && list.at(10) == "ten");
+        assert(list.migrate(5) == 7 && list[4] == "4" && list[12] == "12");
+
+        ListView<std::string> all = list.view();
+        assert(!list.migration_pending() && all.length() == 18 && all[17] == "17" && all[10] == "ten");
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 28.2: Removal, clearing and moves during a migration
+    {
+        std::cout << "Test 28.2: Removal during migration... ";
+        IncrementalList<int, std::allocator<int>, GrowthDouble, 1> list;
+        for (int i = 0; i < 33; i++) {
+            list.add(i);
+        }
+        assert(list.migration_pending());
+        while (list.length() > 5) {
+            list.remove_last();
+        }
+        assert(list.length() == 5 && list[4] == 4 && list.index_of(3) == 3 && !list.contains(5));
+
+        list.remove_at(0);
+        assert(!list.migration_pending() && list[0] == 1);
+
+        for (int i = 0; i < 100; i++) {
+            list.add(i);
+            list.add(list[0]); // Argument refers to an element that may be migrating
+        }
+        assert(list.length() == 204 && list[list.length() - 1] == 1);
+
+        IncrementalList<int, std::allocator<int>, GrowthDouble, 1> moved(std::move(list));
+        assert(list.is_empty() && moved.length() == 204);
+        moved.finish_migration();
+        assert(!moved.migration_pending() && moved.data()[5] == 1);
+        moved.clear();
+        assert(moved.is_empty() && !moved.migration_pending());
+
+#ifndef LIST_NO_CHECKS
+        bool threw = false;
+        try {
+            moved.remove_last();
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw);
+#endif
+        std::cout << "PASSED" << std::endl;
+    }
+
+    std::cout << "\n=== Test Suite 29: Bit-Packed Bool Lists ===" << std::endl;
+
+    // Test 29.1: Flags are packed and accessed through proxies
+    {
+        std::cout << "Test 29.1: Packing and proxies... ";
+        List<bool> flags;
+        for (int i = 0; i < 1000; i++) {
+            flags.add(i % 3 == 0);
+        }
+        assert(flags.length() == 1000 && flags.word_count() == 16 && flags.get_capacity() % 64 == 0);
+        assert(flags[0] && !flags[1] && flags[999]);
+
+        flags[1] = true;
+        flags.set_element(999, false);
+        flags[2] = flags[1];
+        flags.at(3).flip();
+        assert(flags[1] && flags[2] && !flags[3] && !flags.at(999));
+
+        const List<bool>& readonly = flags;
+        size_t set = 0;
+        for (bool flag : readonly) {
+            set += flag ? 1 : 0;
+        }
+        assert(set == readonly.count_true() && set == 334);
+
+        // The iterators work with algorithms that rely on random access and swapping
+        std::reverse(flags.begin(), flags.end());
+        assert(!flags[0] && flags[998] && !flags[996]);
+        std::sort(flags.begin(), flags.end());
+        assert(!flags[665] && flags[666] && flags[999] && flags.count_true() == 334);
+        assert(std::is_sorted(readonly.begin(), readonly.end()));
+        List<bool>::iterator middle = 2 + flags.begin();
+        assert(middle > flags.begin() && middle >= middle && flags.begin() <= middle && middle[-2] == flags[0]);
+
+#ifndef LIST_NO_CHECKS
+        bool threw = false;
+        try {
+            flags.at(1000);
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw);
+#endif
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 29.2: Word-level search, counting, shifting and bulk operations
+    {
+        std::cout << "Test 29.2: Search and bulk operations... ";
+        List<bool> mask;
+        for (int i = 0; i < 200; i++) {
+            mask.add(false);
+        }
+        assert(mask.index_of(true) == -1 && !mask.contains(true) && mask.index_of(false) == 0);
+        mask[70] = true;
+        mask[130] = true;
+        assert(mask.index_of(true) == 70 && mask.find_next_set(71) == 130 && mask.find_next_set(131) == -1);
+        assert(mask.count_of(true) == 2 && mask.count_of(false) == 198);
+
+        mask.insert(0, true); // Everything moves up one bit, across word boundaries
+        assert(mask.length() == 201 && mask[0] && mask[71] && mask[131] && !mask[70]);
+        mask.remove_at(0);
+        assert(mask.find_next_set(0) == 70 && mask.find_next_set(71) == 130);
+
+        List<bool> other;
+        for (int i = 0; i < 200; i++) {
+            other.add(i >= 100);
+        }
+        List<bool> both;
+        for (int i = 0; i < 200; i++) {
+            both.add(mask[static_cast<size_t>(i)]);
+        }
+        both &= other;
+        assert(both.count_true() == 1 && both.index_of(true) == 130);
+        both |= other;
+        assert(both.count_true() == 100);
+        both ^= other;
+        assert(both.count_true() == 0);
+
+        mask.flip_all();
+        assert(mask.count_true() == 198 && mask.find_next_clear(0) == 70);
+
+        List<bool> shorter;
+        shorter.add(true);
+        bool threw = false;
+        try {
+            mask.and_with(shorter);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+
+        List<bool> moved(std::move(mask));
+        assert(mask.is_empty() && moved.length() == 200);
+        moved.clear();
+        assert(moved.is_empty() && moved.count_true() == 0);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    std::cout << "\n=== Test Suite 30: Packed Integer Lists ===" << std::endl;
+
+    // Test 30.1: Sorted IDs with small gaps compress and stay randomly accessible
+    {
+        std::cout << "Test 30.1: Compression and random access... ";
+        PackedIntList<uint64_t> ids;
+        List<uint64_t> plain;
+        uint64_t id = 1000000000ull;
+        for (int i = 0; i < 10000; i++) {
+            id += 1 + static_cast<uint64_t>((i * 37) % 200);
+            ids.add(id);
+            plain.add(id);
+        }
+        assert(ids.length() == 10000 && ids.block_count() == 78);
+        for (size_t i = 0; i < plain.length(); i++) {
+            assert(ids[i] == plain[i]);
+        }
+        assert(ids.at(9999) == plain[9999]);
+        assert(ids.memory_bytes() * 3 < plain.length() * sizeof(uint64_t));
+
+        size_t next = 0;
+        ids.for_each([&](uint64_t value) { assert(value == plain[next++]); });
+        assert(next == 10000);
+
+#ifndef LIST_NO_CHECKS
+        bool threw = false;
+        try {
+            ids.at(10000);
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw);
+#endif
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 30.2: Searching skips blocks by range and handles signed values
+    {
+        std::cout << "Test 30.2: Packed search... ";
+        PackedIntList<int32_t> values;
+        for (int i = 0; i < 1000; i++) {
+            values.add((i % 256) - 128);
+        }
+        assert(values.index_of(-128) == 0 && values.index_of(127) == 255 && values.index_of(0) == 128);
+        assert(values.index_of(200) == -1 && !values.contains(-129));
+        assert(values[998] == (998 % 256) - 128);
+
+        PackedIntList<uint32_t> constant;
+        for (int i = 0; i < 300; i++) {
+            constant.add(7);
+        }
+        assert(constant.memory_bytes() < 300 * sizeof(uint32_t) && constant[150] == 7);
+        assert(constant.index_of(7) == 0 && constant.index_of(8) == -1);
+
+        constant.clear();
+        assert(constant.is_empty() && constant.block_count() == 0);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    std::cout << "\n=== Test Suite 31: Indexed Lists ===" << std::endl;
+
+    // Test 31.1: The index is built past the threshold and kept up to date
+    {
+        std::cout << "Test 31.1: Incremental index maintenance... ";
+        IndexedList<int> list;
+        for (int i = 0; i < 10; i++) {
+            list.add(i * 10);
+        }
+        assert(list.index_of(50) == 5 && !list.is_index_built());
+
+        for (int i = 10; i < 1000; i++) {
+            list.add(i * 10);
+        }
+        assert(list.index_of(9990) == 999 && list.is_index_built());
+        assert(list.contains(5000) && !list.contains(5001));
+
+        list.set_element(3, 7);
+        assert(list.index_of(7) == 3 && !list.contains(30) && list.is_index_built());
+
+        list.swap_remove(0); // 9990 moves to position 0
+        assert(list.index_of(9990) == 0 && !list.contains(0) && list.length() == 999);
+
+        list.add(7);
+        assert(list.index_of(7) == 3 && list.count_of(7) == 2);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 31.2: Shifting operations rebuild the index lazily
+    {
+        std::cout << "Test 31.2: Lazy rebuild... ";
+        IndexedList<std::string> words;
+        for (int i = 0; i < 200; i++) {
+            words.add("w" + std::to_string(i));
+        }
+        assert(words.index_of("w150") == 150);
+
+        words.insert(0, "first");
+        assert(!words.is_index_built());
+        assert(words.index_of("w150") == 151 && words.index_of("first") == 0 && words.is_index_built());
+
+        words.remove_at(1);
+        assert(words.index_of("w0") == -1 && words.index_of("w1") == 1);
+
+        words.clear();
+        assert(words.is_empty() && !words.contains("w1"));
+
+        struct NoCase {
+            bool operator()(const std::string& a, const std::string& b) const {
+                return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+                    return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+                });
+            }
+        };
+        struct NoCaseHash {
+            size_t operator()(const std::string& s) const {
+                std::string lower = s;
+                for (char& c : lower) {
+                    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+                }
+                return std::hash<std::string>()(lower);
+            }
+        };
+        IndexedList<std::string, NoCaseHash, NoCase> names;
+        names.add("Alice");
+        assert(names.index_of("ALICE") == 0);
+        for (int i = 0; i < 100; i++) {
+            names.add("user" + std::to_string(i));
+        }
+        names.build_index();
+        assert(names.is_index_built() && names.index_of("USER42") == 43 && names.count_of("alice") == 1);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 31.3: Duplicates share one index entry and stay consistent under updates
+    {
+        std::cout << "Test 31.3: Duplicate values... ";
+        IndexedList<int> list;
+        for (int i = 0; i < 40000; i++) {
+            list.add(7);
+        }
+        assert(list.index_of(7) == 0 && list.count_of(7) == 40000 && list.is_index_built());
+
+        uint32_t seed = 12345;
+        auto next = [&seed] {
+            seed = seed * 1103515245u + 12345u;
+            return seed >> 16;
+        };
+        for (int step = 0; step < 2000; step++) {
+            int value = static_cast<int>(next() % 4);
+            size_t position = next() % list.length();
+            switch (next() % 3) {
+            case 0:
+                list.add(value);
+                break;
+            case 1:
+                list.set_element(position, value);
+                break;
+            default:
+                list.swap_remove(position);
+                break;
+            }
+        }
+        assert(list.is_index_built());
+        for (int value = 0; value < 8; value++) {
+            long first = -1;
+            size_t copies = 0;
+            for (size_t i = 0; i < list.length(); i++) {
+                if (list[i] == value) {
+                    first = first < 0 ? static_cast<long>(i) : first;
+                    copies++;
+                }
+            }
+            assert(list.index_of(value) == first && list.count_of(value) == copies);
+        }
+        std::cout << "PASSED" << std::endl;
+    }
+
+    std::cout << "\n=== Test Suite 32: Lazy Pipelines ===" << std::endl;
+
+    // Test 32.1: Chained stages run as one pass and collect once
+    {
+        std::cout << "Test 32.1: Fused filter/map/take... ";
+        using namespace list_pipeline;
+        List<int> numbers;
+        for (int i = 0; i < 1000; i++) {
+            numbers.add(i);
+        }
+
+        size_t visited = 0;
+        List<std::string> labels = numbers
+            | filter([&](int n) {
+                  visited++;
+                  return n % 3 == 0;
+              })
+            | map([](int n) { return n * 2; })
+            | filter([](int n) { return n % 4 == 0; })
+            | map([](int n) { return "#" + std::to_string(n); })
+            | take(5)
+            | collect();
+        assert(labels.length() == 5 && labels[0] == "#0" && labels[1] == "#12" && labels[4] == "#48");
+        assert(visited == 25); // The pass stopped right after the fifth result
+
+        List<double> halves = from(numbers) | map([](int n) { return n / 2.0; }) | collect();
+        assert(halves.length() == 1000 && halves.get_capacity() == 1000 && halves[999] == 499.5);
+
+        assert((numbers | filter([](int n) { return n >= 990; })).count() == 10);
+        assert((numbers | take(20)).count() == 20 && (numbers | take(0) | collect()).is_empty());
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 32.2: Pipelines start from views and append into existing lists
+    {
+        std::cout << "Test 32.2: Views and collect_into... ";
+        using namespace list_pipeline;
+        List<int> numbers;
+        for (int i = 0; i < 100; i++) {
+            numbers.add(i);
+        }
+        List<int> out;
+        out.add(-1);
+        (numbers.slice(50, 60) | map([](int n) { return n + 1; })).collect_into(out);
+        assert(out.length() == 11 && out[0] == -1 && out[1] == 51 && out[10] == 60);
+
+        int sum = 0;
+        (numbers.view() | filter([](int n) { return n % 2 == 1; }) | take(3)).for_each([&](int n) { sum += n; });
+        assert(sum == 1 + 3 + 5);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    std::cout << "\n=== Test Suite 33: Batched Lookups ===" << std::endl;
+
+    // Test 33.1: Every strategy agrees with index_of, including duplicate and missing keys
+    {
+        std::cout << "Test 33.1: index_of_many strategies... ";
+        List<int> numbers;
+        for (int i = 0; i < 5000; i++) {
+            numbers.add((i * 7919) % 3000); // Values repeat, so first positions matter
+        }
+        List<int> keys;
+        for (int i = 0; i < 400; i++) {
+            keys.add((i * 37) % 3500 - 100); // Negative and >= 3000 keys are missing
+        }
+        keys.add(keys[0]);
+        keys.add(keys[1]);
+
+        const list_batch::Strategy strategies[] = {list_batch::Strategy::automatic, list_batch::Strategy::blocked,
+                                                   list_batch::Strategy::hashed, list_batch::Strategy::sorted};
+        std::vector<long> found(keys.length());
+        for (list_batch::Strategy strategy : strategies) {
+            std::fill(found.begin(), found.end(), -2);
+            numbers.index_of_many(keys.data(), keys.length(), found.data(), strategy);
+            for (size_t i = 0; i < keys.length(); i++) {
+                assert(found[i] == numbers.index_of(keys[i]));
+            }
+        }
+        assert(found[keys.length() - 2] == found[0] && found[keys.length() - 1] == found[1]);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 33.2: contains_many on lists, views and non-hashable types
+    {
+        std::cout << "Test 33.2: contains_many... ";
+        List<std::string> words;
+        words.add("alpha");
+        words.add("beta");
+        words.add("gamma");
+        const std::string probes[] = {"beta", "delta", "alpha", "beta"};
+        bool present[4];
+        words.contains_many(probes, 4, present, list_batch::Strategy::hashed);
+        assert(present[0] && !present[1] && present[2] && present[3]);
+
+        List<int> numbers;
+        for (int i = 0; i < 100; i++) {
+            numbers.add(i);
+        }
+        const int wanted[] = {5, 50, 95};
+        long positions[3];
+        numbers.slice(40, 60).index_of_many(wanted, 3, positions);
+        assert(positions[0] == -1 && positions[1] == 10 && positions[2] == -1);
+
+        struct Tag {
+            int id;
+            bool operator==(const Tag& other) const {
+                return id == other.id;
+            }
+        };
+        List<Tag> tags;
+        for (int i = 0; i < 300; i++) {
+            tags.add(Tag{i});
+        }
+        std::vector<Tag> lookups;
+        for (int i = 0; i < 40; i++) {
+            lookups.push_back(Tag{i * 10});
+        }
+        bool seen[40];
+        tags.contains_many(lookups.data(), lookups.size(), seen); // No hash or <: falls back to blocked scans
+        for (int i = 0; i < 40; i++) {
+            assert(seen[i] == (i * 10 < 300));
+        }
+
+        numbers.contains_many(wanted, 0, present);
+        List<int>().contains_many(wanted, 3, present);
+        assert(!present[0] && !present[1] && !present[2]);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    std::cout << "\n=== Test Suite 34: List Channels ===" << std::endl;
+
+    // Test 34.1: Producers are throttled to the capacity and values arrive in order
+    {
+        std::cout << "Test 34.1: Threads with backpressure... ";
+        ListChannel<int> channel(16);
+        const int per_producer = 5000;
+        std::vector<std::thread> producers;
+        for (int p = 0; p < 2; p++) {
+            producers.emplace_back([&, p] {
+                for (int i = 0; i < per_producer; i++) {
+                    bool pushed = channel.push(p * per_producer + i);
+                    assert(pushed);
+                    (void)pushed;
+                }
+            });
+        }
+
+        std::thread closer([&] {
+            for (std::thread& producer : producers) {
+                producer.join();
+            }
+            channel.close();
+        });
+
+        List<int> batch;
+        int last[2] = {-1, -1};
+        size_t received = 0;
+        while (size_t n = channel.pop_all(batch)) {
+            assert(n <= channel.get_capacity() && n == batch.length());
+            for (int value : batch) {
+                int producer = value / per_producer;
+                assert(value > last[producer]);
+                last[producer] = value;
+            }
+            received += n;
+        }
+        closer.join();
+        assert(received == 2 * per_producer && last[0] == per_producer - 1 && last[1] == 2 * per_producer - 1);
+        assert(!channel.push(1) && !channel.pop().has_value() && channel.is_closed());
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 34.2: pop_all swaps buffers instead of moving elements
+    {
+        std::cout << "Test 34.2: Batch swap and try operations... ";
+        ListChannel<std::string> channel(4);
+        for (int i = 0; i < 4; i++) {
+            assert(channel.try_push("v" + std::to_string(i)));
+        }
+        assert(!channel.try_push("full") && channel.length() == 4);
+
+        std::string first;
+        assert(channel.try_pop(first) && first == "v0");
+        List<std::string> batch;
+        batch.add("stale");
+        assert(channel.try_pop_all(batch) == 3 && batch[0] == "v1" && batch[2] == "v3");
+        const std::string* buffer_a = batch.data();
+        assert(channel.try_pop_all(batch) == 0 && channel.length() == 0);
+
+        // The consumer's list and the channel trade the same two buffers back and forth
+        channel.try_push("x");
+        assert(channel.pop_all(batch) == 1 && batch[0] == "x");
+        const std::string* buffer_b = batch.data();
+        channel.try_push("y");
+        assert(channel.pop_all(batch) == 1 && batch[0] == "y" && batch.data() == buffer_a);
+        channel.try_push("z");
+        assert(channel.pop_all(batch) == 1 && batch.data() == buffer_b && buffer_a != buffer_b);
+
+        // Popping one at a time keeps FIFO order across front compaction
+        for (int round = 0; round < 10; round++) {
+            channel.try_push(std::to_string(round));
+            std::optional<std::string> value = channel.pop();
+            assert(value && *value == std::to_string(round));
+        }
+
+        bool threw = false;
+        try {
+            ListChannel<int> empty(0);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 34.3: Static buffers are exchanged without any allocation
+    {
+        std::cout << "Test 34.3: Static-buffer channel... ";
+        int front[8];
+        int back[8];
+        ListChannel<int> channel(front, 4);
+        List<int> batch;
+        batch.init_static(back, 8);
+        for (int round = 0; round < 3; round++) {
+            for (int i = 0; i < 4; i++) {
+                assert(channel.try_push(round * 10 + i));
+            }
+            assert(!channel.try_push(-1));
+            assert(channel.pop_all(batch) == 4 && batch[0] == round * 10 && batch[3] == round * 10 + 3);
+            assert(!batch.is_dynamic_allocation() && batch.data() == (round % 2 == 0 ? front : back));
+        }
+        std::cout << "PASSED" << std::endl;
+    }
+
+#if LIST_HAS_COROUTINES
+    // Test 34.4: Coroutines suspend on an empty or full channel and are resumed by the other side
+    {
+        std::cout << "Test 34.4: Coroutine awaitables... ";
+        ListChannel<int> channel(4);
+        List<int> received;
+        int accepted = 0;
+        channel_consumer(channel, received); // Suspends: nothing queued yet
+        channel_producer(channel, 0, 20, accepted); // Each push resumes the consumer directly
+        assert(accepted == 20 && received.length() == 20 && received[19] == 19 && channel.length() == 0);
+
+        ListChannel<int> throttled(4);
+        int throttled_accepted = 0;
+        channel_producer(throttled, 100, 10, throttled_accepted); // Suspends after queuing 4
+        assert(throttled_accepted == 4 && throttled.length() == 4);
+        assert(*throttled.pop() == 100 && throttled_accepted == 5); // The pop let the producer go on
+        List<int> batched;
+        int batches = 0;
+        channel_batch_consumer(throttled, batched, batches); // Drains, resuming the producer
+        assert(throttled_accepted == 10);
+        throttled.close(); // Ends the consumer's loop
+        assert(batched.length() == 9 && batched[0] == 101 && batched[8] == 109 && batches >= 2);
+
+        channel.close(); // Resumes the first consumer with nullopt
+        channel_producer(channel, 0, 3, accepted);
+        assert(accepted == 20);
+        std::cout << "PASSED" << std::endl;
+    }
+#endif
+
+#ifdef LIST_DEBUG
+    std::cout << "\n=== Test Suite 35: Hardened Debug Mode ===" << std::endl;
+
+    // Test 35.1: Stale and out-of-range iterators are caught
+    {
+        std::cout << "Test 35.1: Iterator invalidation detection... ";
+        List<int> list;
+        list.add(1);
+        List<int>::iterator first = list.begin();
+        List<int>::const_iterator last = std::prev(list.cend());
+        assert(*first == 1 && *last == 1 && first == last);
+
+        for (int i = 0; i < 100; i++) {
+            list.add(i); // Grows, so the buffer moves
+        }
+        bool stale = false;
+        try {
+            (void)*first;
+        } catch (const std::logic_error&) {
+            stale = true;
+        }
+        assert(stale);
+
+        List<int>::iterator end = list.end();
+        bool past_end = false;
+        try {
+            (void)*end;
+        } catch (const std::out_of_range&) {
+            past_end = true;
+        }
+        assert(past_end);
+
+        List<int> moved(std::move(list));
+        bool moved_away = false;
+        try {
+            (void)*std::prev(end);
+        } catch (const std::logic_error&) {
+            moved_away = true;
+        }
+        assert(moved_away && *moved.begin() == 1);
+        std::cout << "PASSED" << std::endl;
+    }
+
+    // Test 35.2: Unchecked accessors are checked and freed slots are poisoned
+    {
+        std::cout << "Test 35.2: Checked operator[] and poisoning... ";
+        List<uint32_t> list(8);
+        list.add(0x12345678u);
+        list.add(0x9ABCDEF0u);
+        bool threw = false;
+        try {
+            (void)list[2];
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        assert(threw);
+
+        list.remove_at(1);
+        unsigned char bytes[sizeof(uint32_t)];
+        std::memcpy(bytes, list.data() + 1, sizeof(bytes)); // The vacated slot
+        for (unsigned char byte : bytes) {
+            assert(byte == list_detail::poison_byte);
+        }
+
+        uint32_t caller_buffer[2] = {7, 8};
+        List<uint32_t> static_list;
+        static_list.init_static(caller_buffer, 2, 2);
+        static_list.remove_at(1);
+        assert(caller_buffer[1] == 8); // Caller-owned objects are never poisoned
+        std::cout << "PASSED" << std::endl;
+    }
+#endif
+
     std::cout << "\n=== All tests passed successfully! ===" << std::endl;
     return 0;
 }